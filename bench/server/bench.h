@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** bench/server/bench.h
+** File description:
+** Helpers shared by the server micro-benchmarks
+*/
+
+#ifndef BENCH_H_
+    #define BENCH_H_
+
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <time.h>
+
+    #include "server/server.h"
+    #include "server/map.h"
+
+    #define BENCH_SEED 7U
+    #define BENCH_LOOK_MAP_SIZE 50
+    #define BENCH_LOOK_CALLS 1000000
+    #define BENCH_LOOK_X 10
+    #define BENCH_LOOK_Y 10
+    #define BENCH_STORM_MAP_SIZE 100
+    #define BENCH_STORM_TICKS 200
+    #define BENCH_COMMAND_RANDOM 2000000
+    #define BENCH_COMMAND_RANDOM_LEN 6
+    #define BENCH_COMMAND_LOOKUPS 10000000
+    #define BENCH_MAP_BOTS 1000
+    #define BENCH_MAP_TICKS 300
+    #define BENCH_MAP_THREADS 4
+    #define BENCH_CROWD_MAP_SIZE 50
+    #define BENCH_CROWD_BOTS 1200
+    #define BENCH_MAP_SOCKET "/tmp/zappy_bench_map.sock"
+
+static inline double bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+// Same generator on every run so two builds see the same inputs
+static inline uint32_t bench_rand(uint32_t *state)
+{
+    *state = *state * 1664525U + 1013904223U;
+    return *state >> 8;
+}
+
+// Spreads the subject's densities: per hundred tiles, 50 food down to 5
+// thystame, at random tiles
+static inline void bench_fill_map(map_t *map, uint32_t seed)
+{
+    static const int density[RESOURCE_COUNT] = {50, 30, 15, 10, 10, 8, 5};
+    size_t count;
+
+    for (int type = 0; type < RESOURCE_COUNT; ++type) {
+        count = map->tile_count * density[type] / 100;
+        for (size_t i = 0; i < count; ++i)
+            map_add_resource(map, bench_rand(&seed) % map->tile_count,
+                type, 1);
+    }
+}
+
+#endif /* !BENCH_H_ */
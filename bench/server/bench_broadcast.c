@@ -0,0 +1,163 @@
+/*
+** EPITECH PROJECT, 2025
+** bench/server/bench_broadcast.c
+** File description:
+** Broadcast storms: N players, M broadcasts per tick
+*/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "server/ai_command_handlers.h"
+#include "bench.h"
+
+// Each client writes to a real socket whose peer is drained between
+// ticks, so the sends are part of what is timed
+typedef struct storm_s {
+    server_t server;
+    game_state_t game;
+    client_t *clients;
+    client_t **active;
+    player_t *players;
+    int *peers;
+} storm_t;
+
+static int add_player(storm_t *storm, size_t i, uint32_t *seed)
+{
+    int fds[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == -1)
+        return -1;
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+    storm->peers[i] = fds[1];
+    storm->players[i] = (player_t){.id = (int)i,
+        .x = bench_rand(seed) % BENCH_STORM_MAP_SIZE,
+        .y = bench_rand(seed) % BENCH_STORM_MAP_SIZE,
+        .orientation = bench_rand(seed) % 4 + 1, .level = 1,
+        .client = &storm->clients[i], .is_alive = true};
+    storm->clients[i] = (client_t){.fd = fds[0], .type = CLIENT_TYPE_AI,
+        .is_authenticated = true, .player = &storm->players[i]};
+    storm->active[i] = &storm->clients[i];
+    storm->server.client_count++;
+    return 0;
+}
+
+static int storm_create(storm_t *storm, size_t players)
+{
+    uint32_t seed = BENCH_SEED;
+
+    *storm = (storm_t){0};
+    storm->clients = calloc(players, sizeof(client_t));
+    storm->active = calloc(players, sizeof(client_t *));
+    storm->players = calloc(players, sizeof(player_t));
+    storm->peers = calloc(players, sizeof(int));
+    storm->game.map = map_create(BENCH_STORM_MAP_SIZE, BENCH_STORM_MAP_SIZE);
+    storm->server.game = &storm->game;
+    storm->server.clients = storm->active;
+    if (!storm->clients || !storm->active || !storm->players ||
+        !storm->peers || !storm->game.map)
+        return -1;
+    for (size_t i = 0; i < players; ++i) {
+        if (add_player(storm, i, &seed) == -1)
+            return -1;
+    }
+    return 0;
+}
+
+static void storm_destroy(storm_t *storm)
+{
+    for (size_t i = 0; i < storm->server.client_count; ++i) {
+        close(storm->clients[i].fd);
+        close(storm->peers[i]);
+    }
+    if (storm->game.map)
+        map_destroy(storm->game.map);
+    free(storm->clients);
+    free(storm->active);
+    free(storm->players);
+    free(storm->peers);
+}
+
+static void drain_peers(const storm_t *storm)
+{
+    char buffer[BUFFER_SIZE];
+
+    for (size_t i = 0; i < storm->server.client_count; ++i) {
+        while (read(storm->peers[i], buffer, sizeof(buffer)) > 0);
+    }
+}
+
+static double run_storm(storm_t *storm, size_t per_tick)
+{
+    char msg[] = "regroup 12 34 level 3";
+    size_t count = storm->server.client_count;
+    uint32_t seed = BENCH_SEED;
+    double elapsed = 0.0;
+    double started;
+
+    for (int tick = 0; tick < BENCH_STORM_TICKS; ++tick) {
+        started = bench_now();
+        for (size_t i = 0; i < per_tick; ++i)
+            ai_action_broadcast(&storm->server,
+                &storm->clients[bench_rand(&seed) % count], msg);
+        elapsed += bench_now() - started;
+        drain_peers(storm);
+    }
+    return elapsed;
+}
+
+// The part user-041 changed, without the syscalls: one direction per
+// receiver of every broadcast
+static double run_directions(const storm_t *storm, size_t per_tick)
+{
+    size_t count = storm->server.client_count;
+    uint32_t seed = BENCH_SEED;
+    volatile int sink = 0;
+    double started = bench_now();
+    const player_t *sender;
+
+    for (int tick = 0; tick < BENCH_STORM_TICKS; ++tick) {
+        for (size_t i = 0; i < per_tick; ++i) {
+            sender = &storm->players[bench_rand(&seed) % count];
+            for (size_t r = 0; r < count; ++r)
+                sink += &storm->players[r] == sender ? 0 :
+                    compute_direction(storm->game.map, sender,
+                    &storm->players[r]);
+        }
+    }
+    (void)sink;
+    return bench_now() - started;
+}
+
+static void report(const size_t *scenario, double elapsed,
+    double directions)
+{
+    double receivers = (double)BENCH_STORM_TICKS * scenario[1] *
+        (scenario[0] - 1);
+
+    printf("%4zu players, %3zu broadcasts/tick: %9.1f us/tick, "
+        "%6.1f ns/receiver, %4.1f ns of it direction\n", scenario[0],
+        scenario[1], elapsed / BENCH_STORM_TICKS * 1e6,
+        elapsed / receivers * 1e9, directions / receivers * 1e9);
+}
+
+int main(void)
+{
+    static const size_t scenarios[][2] = {{10, 1}, {100, 10}, {400, 40}};
+    storm_t storm;
+    double elapsed;
+
+    g_log_level = LOG_LEVEL_NONE;
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(*scenarios); ++s) {
+        if (storm_create(&storm, scenarios[s][0]) == -1) {
+            storm_destroy(&storm);
+            return 84;
+        }
+        elapsed = run_storm(&storm, scenarios[s][1]);
+        report(scenarios[s], elapsed,
+            run_directions(&storm, scenarios[s][1]));
+        storm_destroy(&storm);
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+** EPITECH PROJECT, 2025
+** bench/server/bench_commands.c
+** File description:
+** Command dispatch: perfect hash checked against a linear scan, then timed
+*/
+
+#include <limits.h>
+#include <string.h>
+
+#include "server/ai_commands.h"
+#include "server/protocol_graphic.h"
+#include "bench.h"
+
+// One protocol's table seen as names by slot, found either way as a slot
+// index, -1 when nothing matches
+typedef struct table_view_s {
+    const char *label;
+    const char *names[COMMAND_SLOTS];
+    size_t lens[COMMAND_SLOTS];
+    size_t key;
+    int (*hashed)(const char *cmd);
+    const char *const *stream;
+    size_t stream_len;
+} table_view_t;
+
+static const char *const ai_stream[] = {
+    "Forward", "Forward", "Look", "Inventory", "Take food", "Forward",
+    "Right", "Look", "Broadcast 12 regroup", "Take linemate", "Connect_nbr",
+    "Left", "Forward", "Set linemate", "Incantation", "Fork", "Eject",
+    "Inventory",
+};
+
+static const char *const gui_stream[] = {
+    "ppo #12", "pin #12", "plv #12", "bct 3 4", "sgt", "msz", "ppo #40",
+    "pin #40", "mct", "tna",
+};
+
+static int ai_hashed(const char *cmd)
+{
+    const ai_cmd_t *entry = ai_command_find(cmd);
+
+    return entry ? (int)(entry - ai_commands) : -1;
+}
+
+static int gui_hashed(const char *cmd)
+{
+    const graphic_cmd_entry_t *entry = graphic_command_find(cmd);
+
+    return entry ? (int)(entry - graphic_commands) : -1;
+}
+
+// The dispatch before the hash: the first name that prefixes the command
+static int linear_find(const table_view_t *table, const char *cmd)
+{
+    for (int i = 0; i < COMMAND_SLOTS; ++i) {
+        if (table->names[i] &&
+            strncmp(cmd, table->names[i], table->lens[i]) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static void load_views(table_view_t *ai, table_view_t *gui)
+{
+    *ai = (table_view_t){"AI", {0}, {0}, AI_KEY_INDEX, ai_hashed,
+        ai_stream, sizeof(ai_stream) / sizeof(*ai_stream)};
+    *gui = (table_view_t){"GUI", {0}, {0}, GUI_KEY_INDEX, gui_hashed,
+        gui_stream, sizeof(gui_stream) / sizeof(*gui_stream)};
+    for (int i = 0; i < COMMAND_SLOTS; ++i) {
+        ai->names[i] = ai_commands[i].name;
+        ai->lens[i] = ai_commands[i].len;
+        gui->names[i] = graphic_commands[i].cmd;
+        gui->lens[i] = graphic_commands[i].len;
+    }
+}
+
+// No name may prefix another, or the linear scan would depend on order
+static int check_prefixes(const table_view_t *table, int i)
+{
+    int errors = 0;
+
+    for (int j = 0; j < COMMAND_SLOTS; ++j) {
+        if (j != i && table->names[j] &&
+            strncmp(table->names[j], table->names[i], table->lens[i]) == 0) {
+            printf("%s: \"%s\" prefixes \"%s\"\n", table->label,
+                table->names[i], table->names[j]);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+// Two entries given the same slot are caught by -Woverride-init, an entry
+// whose first and key characters do not match its name is caught here
+static int check_slots(const table_view_t *table)
+{
+    const char *name;
+    int errors = 0;
+
+    for (int i = 0; i < COMMAND_SLOTS; ++i) {
+        name = table->names[i];
+        if (!name)
+            continue;
+        if (table->lens[i] <= table->key ||
+            (int)COMMAND_SLOT(name[0], name[table->key]) != i) {
+            printf("%s: \"%s\" is not in its own slot\n", table->label, name);
+            errors++;
+        }
+        errors += check_prefixes(table, i);
+    }
+    return errors;
+}
+
+static int compare(const table_view_t *table, const char *cmd)
+{
+    int expected = linear_find(table, cmd);
+    int found = table->hashed(cmd);
+
+    if (expected == found)
+        return 0;
+    printf("%s: \"%s\" dispatched to slot %d instead of %d\n",
+        table->label, cmd, found, expected);
+    return 1;
+}
+
+// The name, each of its prefixes, and it followed by an argument or junk
+static int check_name(const table_view_t *table, int i, size_t *checked)
+{
+    char cmd[BUFFER_SIZE];
+    int errors = 0;
+
+    for (size_t len = 0; len <= table->lens[i]; ++len) {
+        snprintf(cmd, sizeof(cmd), "%.*s", (int)len, table->names[i]);
+        errors += compare(table, cmd);
+    }
+    snprintf(cmd, sizeof(cmd), "%s 1 2", table->names[i]);
+    errors += compare(table, cmd);
+    snprintf(cmd, sizeof(cmd), "%sx", table->names[i]);
+    errors += compare(table, cmd);
+    *checked += table->lens[i] + 3;
+    return errors;
+}
+
+static int check_names(const table_view_t *table, size_t *checked)
+{
+    int errors = 0;
+
+    for (int i = 0; i < COMMAND_SLOTS; ++i)
+        if (table->names[i])
+            errors += check_name(table, i, checked);
+    return errors;
+}
+
+// Every character used by a name, plus the ones arguments bring
+static size_t build_alphabet(const table_view_t *table, char *alphabet)
+{
+    size_t len = strlen(strcpy(alphabet, " #1"));
+
+    for (int i = 0; i < COMMAND_SLOTS; ++i) {
+        for (size_t c = 0; table->names[i] && c < table->lens[i]; ++c) {
+            if (!memchr(alphabet, table->names[i][c], len))
+                alphabet[len++] = table->names[i][c];
+        }
+    }
+    alphabet[len] = '\0';
+    return len;
+}
+
+// Short strings drawn from the alphabet, so that prefixes of names and
+// strings sharing their first and key characters come up often
+static int check_random(const table_view_t *table, size_t *checked)
+{
+    char alphabet[UCHAR_MAX + 1];
+    size_t letters = build_alphabet(table, alphabet);
+    char cmd[BENCH_COMMAND_RANDOM_LEN];
+    uint32_t seed = BENCH_SEED;
+    size_t len;
+    int errors = 0;
+
+    for (size_t n = 0; n < BENCH_COMMAND_RANDOM; ++n) {
+        len = bench_rand(&seed) % BENCH_COMMAND_RANDOM_LEN;
+        for (size_t i = 0; i < len; ++i)
+            cmd[i] = alphabet[bench_rand(&seed) % letters];
+        cmd[len] = '\0';
+        errors += compare(table, cmd);
+    }
+    *checked += BENCH_COMMAND_RANDOM;
+    return errors;
+}
+
+static double time_lookups(const table_view_t *table, bool hashed)
+{
+    volatile int sink = 0;
+    const char *cmd;
+    double started = bench_now();
+
+    for (size_t i = 0; i < BENCH_COMMAND_LOOKUPS; ++i) {
+        cmd = table->stream[i % table->stream_len];
+        sink += hashed ? table->hashed(cmd) : linear_find(table, cmd);
+    }
+    (void)sink;
+    return (bench_now() - started) * 1e9 / BENCH_COMMAND_LOOKUPS;
+}
+
+static int run_table(const table_view_t *table)
+{
+    size_t checked = 0;
+    int errors = check_slots(table);
+
+    errors += check_names(table, &checked);
+    errors += check_random(table, &checked);
+    printf("%s: %zu inputs checked, %d mismatches\n", table->label,
+        checked, errors);
+    printf("%s: linear %.1f ns/cmd, hashed %.1f ns/cmd\n", table->label,
+        time_lookups(table, false), time_lookups(table, true));
+    return errors;
+}
+
+int main(void)
+{
+    table_view_t ai;
+    table_view_t gui;
+    int errors;
+
+    g_log_level = LOG_LEVEL_NONE;
+    load_views(&ai, &gui);
+    errors = run_table(&ai);
+    errors += run_table(&gui);
+    return errors ? 84 : 0;
+}
@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** bench/server/bench_look.c
+** File description:
+** Look latency by level on a 50x50 map with the subject's densities
+*/
+
+#include <string.h>
+
+#include "server/vision.h"
+#include "bench.h"
+
+// Fewer calls at higher levels, a level 8 Look reads 81 tiles
+static int bench_level(client_t *client, map_t *map, int level)
+{
+    size_t calls = BENCH_LOOK_CALLS / level;
+    size_t bytes = 0;
+    double started = bench_now();
+    char *line;
+
+    client->player->level = level;
+    for (size_t i = 0; i < calls; ++i) {
+        client->player->orientation = (int)(i % 4) + 1;
+        line = vision_look(client, map);
+        if (!line)
+            return -1;
+        bytes += strlen(line);
+        free(line);
+    }
+    printf("level %d: %6.0f ns/Look %5zu B\n", level,
+        (bench_now() - started) / calls * 1e9, bytes / calls);
+    return 0;
+}
+
+// The player stands on its own tile like in a game, so tile 0 says so
+int main(void)
+{
+    map_t *map = map_create(BENCH_LOOK_MAP_SIZE, BENCH_LOOK_MAP_SIZE);
+    player_t player = {.x = BENCH_LOOK_X, .y = BENCH_LOOK_Y, .level = 1};
+    client_t client = {.player = &player};
+    occupancy_t *slot;
+
+    g_log_level = LOG_LEVEL_NONE;
+    if (!map)
+        return 84;
+    bench_fill_map(map, BENCH_SEED);
+    slot = map_occupy(map, map_tile_at(map, player.x, player.y));
+    *slot = (occupancy_t){slot->tile, 1, &player};
+    vision_init();
+    for (int level = 1; level <= VISION_MAX_LEVEL; ++level) {
+        if (bench_level(&client, map, level) == -1)
+            return 84;
+    }
+    map_destroy(map);
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*
+** EPITECH PROJECT, 2025
+** bench/server/bench_map.c
+** File description:
+** Memory and tick time of a whole server on large and crowded maps
+*/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "server/broadcast.h"
+#include "server/resource.h"
+#include "server/tick_pool.h"
+#include "bench.h"
+
+// Bots connect on the unix socket and keep one command in flight, picked
+// from a wandering mix, so Forward dominates as it does in real games
+typedef struct bot_s {
+    int fd;
+    bool pending;
+} bot_t;
+
+typedef struct scenario_s {
+    int size;
+    size_t bots;
+    size_t threads;
+} scenario_t;
+
+static const char *const bot_commands[] = {
+    "Forward\n", "Forward\n", "Forward\n", "Forward\n", "Forward\n",
+    "Left\n", "Right\n", "Look\n", "Look\n", "Inventory\n", "Take food\n",
+    "Set food\n",
+};
+
+static long rss_kb(void)
+{
+    FILE *status = fopen("/proc/self/status", "r");
+    char line[BUFFER_SIZE];
+    long rss = 0;
+
+    while (status && fgets(line, sizeof(line), status))
+        if (strncmp(line, "VmRSS:", 6) == 0)
+            rss = atol(line + 6);
+    if (status)
+        fclose(status);
+    return rss;
+}
+
+static int create_server(server_t *server, const scenario_t *scenario)
+{
+    static char *teams[] = {"red", "blue", NULL};
+    server_config_t config = {.width = scenario->size,
+        .height = scenario->size, .max_clients_per_team = scenario->bots,
+        .freq = 100, .team_names = teams, .team_count = 2,
+        .refill_tiles = true, .log_level = LOG_LEVEL_NONE,
+        .unix_path = BENCH_MAP_SOCKET, .seed = BENCH_SEED, .has_seed = true,
+        .tick_threads = scenario->threads};
+
+    *server = (server_t){0};
+    unlink(BENCH_MAP_SOCKET);
+    if (server_create(server, &config) == -1)
+        return -1;
+    server->is_running = true;
+    return 0;
+}
+
+static void pump(server_t *server)
+{
+    int ready;
+
+    for (int i = 0; i < 4; ++i) {
+        ready = poll(server->poll_fds, server->poll_count, 0);
+        if (ready <= 0)
+            return;
+        network_handle_events(server, ready);
+    }
+}
+
+static int join(server_t *server, bot_t *bot, size_t i)
+{
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    const char *team = i % 2 ? "blue\n" : "red\n";
+
+    strcpy(addr.sun_path, BENCH_MAP_SOCKET);
+    bot->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (bot->fd == -1 ||
+        connect(bot->fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+        return -1;
+    fcntl(bot->fd, F_SETFL, O_NONBLOCK);
+    network_accept_connections(server, server->unix_fd);
+    if (write(bot->fd, team, strlen(team)) == -1)
+        return -1;
+    pump(server);
+    return 0;
+}
+
+// A reply ends with a newline, which frees the bot for its next command
+static void drain(bot_t *bot)
+{
+    char buffer[BUFFER_SIZE];
+    ssize_t len;
+
+    while ((len = read(bot->fd, buffer, sizeof(buffer))) > 0)
+        if (memchr(buffer, '\n', len))
+            bot->pending = false;
+}
+
+// run_tick without the snapshot, journal and metrics hooks, all off here
+static void run_tick(server_t *server)
+{
+    server->tick_count++;
+    tick_pool_process_actions(server);
+    if (server->tick_count % 20 == 0)
+        respawn_resources(server);
+    tick_pool_update_players(server);
+    broadcast_dirty_tiles(server);
+}
+
+static void send_commands(bot_t *bots, size_t count, uint32_t *seed)
+{
+    const char *cmd;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (bots[i].pending)
+            continue;
+        cmd = bot_commands[bench_rand(seed) %
+            (sizeof(bot_commands) / sizeof(*bot_commands))];
+        bots[i].pending = write(bots[i].fd, cmd, strlen(cmd)) > 0;
+    }
+}
+
+static double play(server_t *server, bot_t *bots, size_t count)
+{
+    uint32_t seed = BENCH_SEED;
+    double elapsed = 0.0;
+    double started;
+
+    for (int tick = 0; tick < BENCH_MAP_TICKS; ++tick) {
+        send_commands(bots, count, &seed);
+        pump(server);
+        started = bench_now();
+        run_tick(server);
+        elapsed += bench_now() - started;
+        for (size_t i = 0; i < count; ++i)
+            drain(&bots[i]);
+    }
+    return elapsed / BENCH_MAP_TICKS;
+}
+
+static int run_scenario(const scenario_t *scenario, bot_t *bots)
+{
+    server_t server;
+    long before = rss_kb();
+    long created;
+    double tick;
+
+    if (create_server(&server, scenario) == -1)
+        return -1;
+    created = rss_kb();
+    for (size_t i = 0; i < scenario->bots; ++i)
+        if (join(&server, &bots[i], i) == -1)
+            return -1;
+    tick = play(&server, bots, scenario->bots);
+    printf("%4dx%-4d %4zu bots %zu thread(s): %7ld kB created, %7ld kB "
+        "played, %8.1f us/tick\n", scenario->size, scenario->size,
+        scenario->bots, scenario->threads, created - before,
+        rss_kb() - before, tick * 1e6);
+    server_destroy(&server);
+    for (size_t i = 0; i < scenario->bots; ++i)
+        close(bots[i].fd);
+    return 0;
+}
+
+// Each scenario runs in its own process so its RSS starts from scratch.
+// The 50x50 ones pack every region with players, the case tick threads
+// are meant for, and are played serially then with 2 and 4 threads.
+static int fork_scenario(const scenario_t *scenario)
+{
+    bot_t *bots;
+    pid_t pid = fork();
+    int status = 84;
+
+    if (pid == 0) {
+        bots = calloc(scenario->bots, sizeof(bot_t));
+        exit(bots && run_scenario(scenario, bots) == 0 ? 0 : 84);
+    }
+    if (pid == -1 || waitpid(pid, &status, 0) == -1)
+        return -1;
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+
+int main(void)
+{
+    static const scenario_t scenarios[] = {{500, BENCH_MAP_BOTS, 1},
+        {500, BENCH_MAP_BOTS, BENCH_MAP_THREADS}, {2000, BENCH_MAP_BOTS, 1},
+        {2000, BENCH_MAP_BOTS, BENCH_MAP_THREADS},
+        {BENCH_CROWD_MAP_SIZE, BENCH_CROWD_BOTS, 1},
+        {BENCH_CROWD_MAP_SIZE, BENCH_CROWD_BOTS, 2},
+        {BENCH_CROWD_MAP_SIZE, BENCH_CROWD_BOTS, BENCH_MAP_THREADS}};
+    int status = 0;
+
+    g_log_level = LOG_LEVEL_NONE;
+    fflush(stdout);
+    for (size_t s = 0; status == 0 &&
+        s < sizeof(scenarios) / sizeof(*scenarios); ++s)
+        status = fork_scenario(&scenarios[s]);
+    unlink(BENCH_MAP_SOCKET);
+    return status == 0 ? 0 : 84;
+}
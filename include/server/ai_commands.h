@@ -10,16 +10,27 @@
 
     #include "server/server.h"
     #include "server/protocol_ai.h"
+    #include "server/command_hash.h"
+
+    // first and key repeat name[0] and name[AI_KEY_INDEX], a string
+    // literal cannot be indexed in a constant expression
+    #define AI_ENTRY(first, key, name, fn, arg) \
+        [COMMAND_SLOT(first, key)] = {name, sizeof(name) - 1, fn, arg}
 
 typedef void (*ai_cmd_fn_t)(server_t *, client_t *, const char *);
 
+// has_arg commands get the text after their name, the others NULL
 typedef struct {
     const char *name;
-    int len;
+    size_t len;
     ai_cmd_fn_t fn;
+    bool has_arg;
 } ai_cmd_t;
 
-extern const ai_cmd_t ai_commands[];
-extern const size_t ai_commands_count;
+// Indexed by COMMAND_SLOT of the name, empty slots have a NULL name
+extern const ai_cmd_t ai_commands[COMMAND_SLOTS];
+
+// The entry whose name prefixes cmd, or NULL
+const ai_cmd_t *ai_command_find(const char *cmd);
 
 #endif // AI_COMMANDS_H
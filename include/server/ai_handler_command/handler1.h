@@ -24,12 +24,7 @@ static inline void ai_action_forward(server_t *server, client_t *client,
     (void)cmd;
     if (!server || !client)
         return;
-    for (size_t i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == client->fd) {
-            p = server->game->players[i];
-            break;
-        }
-    }
+    p = client->player;
     if (!p)
         return send_response(client, "ko\n");
     player_set_position(server, p,
@@ -40,19 +35,12 @@ static inline void ai_action_forward(server_t *server, client_t *client,
 static inline void ai_action_right(server_t *server, client_t *client,
     char *cmd)
 {
-    size_t i;
     player_t *p;
 
     (void)cmd;
     if (!server || !client)
         return;
-    p = NULL;
-    for (i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == client->fd) {
-            p = server->game->players[i];
-            break;
-        }
-    }
+    p = client->player;
     if (!p)
         return send_response(client, "ko\n");
     p->orientation = (p->orientation % 4) + 1;
@@ -63,18 +51,12 @@ static inline void ai_action_right(server_t *server, client_t *client,
 static inline void ai_action_left(server_t *server, client_t *client,
     char *cmd)
 {
-    size_t i;
     player_t *p = NULL;
 
     (void)cmd;
     if (!server || !client)
         return;
-    for (i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == client->fd) {
-            p = server->game->players[i];
-            break;
-        }
-    }
+    p = client->player;
     if (!p)
         return send_response(client, "ko\n");
     p->orientation = (p->orientation == 1) ? 4 : p->orientation - 1;
@@ -93,25 +75,12 @@ static inline void ai_action_look(server_t *server, client_t *client,
     result = vision_look(client, server->game->map);
     if (result) {
         send_response(client, result);
-        da_destroy(result);
+        free(result);
     } else {
         send_response(client, "[]\n");
     }
 }
 
-static inline player_t *find_player_by_fd(server_t *server, int fd)
-{
-    size_t i;
-
-    if (!server)
-        return NULL;
-    for (i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == fd)
-            return server->game->players[i];
-    }
-    return NULL;
-}
-
 static inline int format_inventory_string(char **buf, player_t *p)
 {
     if (!p)
@@ -134,7 +103,7 @@ static inline void ai_action_inventory(server_t *server, client_t *client,
     (void)cmd;
     if (!server || !client)
         return;
-    p = find_player_by_fd(server, client->fd);
+    p = client->player;
     if (!p) {
         send_response(client, "ko\n");
         return;
@@ -17,6 +17,8 @@
     #include "server/resource.h"
     #include "server/broadcast.h"
     #include "server/incantation.h"
+    #include "server/map.h"
+    #include "server/journal.h"
 
 static inline void ai_action_take(server_t *server,
     client_t *client, char *cmd)
@@ -26,13 +28,9 @@ static inline void ai_action_take(server_t *server,
 
     if (!server || !client)
         return;
-    for (size_t i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == client->fd) {
-            p = server->game->players[i];
-            break;
-        }
-    }
-    if (!p || take_resource(client, server->game->map, resource_id) == -1) {
+    p = client->player;
+    if (!p || resource_id < 0 ||
+        take_resource(client, server->game->map, resource_id) == -1) {
         return send_response(client, "ko\n");
     }
     ++p->resources[resource_id];
@@ -40,27 +38,32 @@ static inline void ai_action_take(server_t *server,
     broadcast_player_resource_update(server, p, resource_id,
         gui_payload_pgt);
     broadcast_message_to_guis(server, p, gui_payload_pin);
+    journal_player(server, JOURNAL_PIN, p);
+    journal_tile(server, map_tile_at(server->game->map, p->x, p->y));
 }
 
 static inline void ai_action_set(server_t *server, client_t *client, char *cmd)
 {
     int resource_id = ressource_string_to_id(cmd);
     player_t *p;
-    tile_t *tile;
+    tile_id_t tile;
 
     if (!server || !client || !client->player ||
         resource_id < 0 || resource_id >= RESOURCE_COUNT)
         return send_response(client, "ko\n");
     p = client->player;
-    tile = map_get_tile(server->game->map, p->x, p->y);
-    if (!tile || p->resources[resource_id] <= 0)
+    tile = map_tile_at(server->game->map, p->x, p->y);
+    if (tile == TILE_NONE || p->resources[resource_id] <= 0 ||
+        map_stack(server->game->map, tile, resource_id) >= TILE_STACK_MAX)
         return send_response(client, "ko\n");
     p->resources[resource_id]--;
-    tile->resources[resource_id]++;
+    map_add_resource(server->game->map, tile, resource_id, 1);
     send_response(client, "ok\n");
     broadcast_player_resource_update(server, p, resource_id,
         gui_payload_pdr);
     broadcast_message_to_guis(server, p, gui_payload_pin);
+    journal_player(server, JOURNAL_PIN, p);
+    journal_tile(server, tile);
 }
 
 static inline void ai_action_incantation(server_t *server,
@@ -92,24 +95,22 @@ static inline void ai_action_incantation(server_t *server,
 // 2                      1   0
 // 3                      0   1
 // 4                      -1  0
+// A moved player is pushed at the head of its new list, so even when the
+// push wraps back onto this tile the walk never meets it twice
 static inline size_t eject_other_players(server_t *server,
     client_t *self_client, int dx, int dy)
 {
-    player_t *self = self_client ? self_client->player : NULL;
-    int width = server ? server->game->map->width : 0;
-    int height = server ? server->game->map->height : 0;
+    player_t *self = self_client->player;
+    player_t *next = NULL;
     size_t ejected = 0;
-    client_t *other;
 
-    for (size_t i = 0; i < server->client_count; ++i) {
-        other = &server->clients[i];
-        if (other != self_client && other->type == CLIENT_TYPE_AI
-            && other->player
-            && other->player->x == self->x && other->player->y == self->y) {
-            other->player->x = (other->player->x + dx + width) % width;
-            other->player->y = (other->player->y + dy + height) % height;
-            ejected++;
-        }
+    for (player_t *other = map_occupants(server->game->map, self->tile);
+        other; other = next) {
+        next = other->tile_next;
+        if (other == self)
+            continue;
+        player_set_position(server, other, other->x + dx, other->y + dy);
+        ejected++;
     }
     return ejected;
 }
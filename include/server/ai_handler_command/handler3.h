@@ -8,23 +8,8 @@
 #ifndef AI_ACTIONS3_H
     #define AI_ACTIONS3_H
 
-    #include <string.h>
-
     #include "server/egg_manager.h"
-
-static inline int get_team_player_count(server_t *server,
-    const char *team_name)
-{
-    int count = 0;
-    player_t *p = NULL;
-
-    for (size_t i = 0; i < server->game->player_count; ++i) {
-        p = server->game->players[i];
-        if (p && p->team_name && strcmp(p->team_name, team_name) == 0)
-            count++;
-    }
-    return count;
-}
+    #include "server/team.h"
 
 static inline void ai_action_connect_nbr(server_t *server,
     client_t *client, char *cmd)
@@ -33,16 +18,15 @@ static inline void ai_action_connect_nbr(server_t *server,
     char *buf = NULL;
     int ret;
     size_t current;
-    size_t egg_slots;
 
-    if (!server || !client || !client->team_name) {
+    if (!server || !client || !client->player) {
         send_response(client, "ko\n");
         return (void)cmd;
     }
-    current = get_team_player_count(server, client->team_name);
-    egg_slots = egg_manager_get_available_count(server, client->team_name);
+    current = team_members_of(server->game, client->player);
     available = (current > available) ? 0 : available - current;
-    available += egg_slots;
+    available += egg_manager_get_available_count(server,
+        client->player->team_id);
     ret = asprintf(&buf, "%ld\n", available);
     if (ret < 0 || !buf) {
         return send_response(client, "ko\n");
@@ -8,14 +8,12 @@
 #ifndef AI_ACTIONS4_H
     #define AI_ACTIONS4_H
 
-    #include <math.h>
     #include <stdio.h>
 
     #include "server/server.h"
 
-    #ifndef M_PI
-        #define M_PI 3.14159265358979323846
-    #endif
+    // Offset of the direction digit in "message K, text\n"
+    #define BROADCAST_DIGIT 8
 
 static inline void helper_send_pbc(server_t *server, client_t *client,
     player_t *sender, const char *msg)
@@ -29,7 +27,7 @@ static inline void helper_send_pbc(server_t *server, client_t *client,
     if (ret < 0 || !buf)
         return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        other = &server->clients[i];
+        other = server->clients[i];
         if (other->type == CLIENT_TYPE_GRAPHIC) {
             send_response(other, buf);
         }
@@ -37,76 +35,70 @@ static inline void helper_send_pbc(server_t *server, client_t *client,
     free(buf);
 }
 
-static inline int compute_direction_from_angle(double angle, int orient)
+// Folds a delta onto the shortest way around the torus
+static inline int torus_delta(int d, int size)
 {
-    int direction = 0;
-
-    if (angle >= 337.5 || angle < 22.5)
-        direction = 3;
-    if (angle >= 22.5 && angle < 67.5)
-        direction = 2;
-    if (angle >= 67.5 && angle < 112.5)
-        direction = 1;
-    if (angle >= 112.5 && angle < 157.5)
-        direction = 8;
-    if (angle >= 157.5 && angle < 202.5)
-        direction = 7;
-    if (angle >= 202.5 && angle < 247.5)
-        direction = 6;
-    if (angle >= 247.5 && angle < 292.5)
-        direction = 5;
-    if (angle >= 292.5 && angle < 337.5)
-        direction = 4;
-    orient = (orient < 1 || orient > 4) ? 1 : orient;
-    return ((direction - 1 + 2 * (orient - 1)) % 8) + 1;
+    if (d > size / 2)
+        d -= size;
+    if (d < (-size / 2))
+        d += size;
+    return d;
 }
 
-static inline int compute_direction(int *xy,
-    int width, int height, int orient)
+// Octant of (a, b), b pointing north, as the tile number seen by a player
+// facing north. A component is dropped when the vector is within 22.5
+// degrees of the other axis: |b| < tan(22.5) |a| is (|a| + |b|)^2 < 2 a^2,
+// exact in integers and never a tie since tan(22.5) is irrational.
+static inline int octant_direction(int a, int b)
 {
-    int direction = 0;
-    double angle;
-
-    if (*xy > width / 2)
-        *xy -= width;
-    if (*xy < (-width / 2))
-        *xy += width;
-    if (*(xy + 1) > height / 2)
-        *(xy + 1) -= height;
-    if (*(xy + 1) < (-height / 2))
-        *(xy + 1) += height;
-    if (*xy == 0 && *(xy + 1) == 0) {
-        direction = 0;
-    } else {
-        angle = atan2(-(double)*(xy + 1), (double)*xy) * 180.0 / M_PI;
-        angle += angle < 0 ? 360.0 : 0.0;
-        direction = compute_direction_from_angle(angle, orient);
-    }
-    return direction;
+    static const int dirs[3][3] = {{6, 7, 8}, {5, 0, 1}, {4, 3, 2}};
+    long long ax = a < 0 ? -(long long)a : a;
+    long long ay = b < 0 ? -(long long)b : b;
+    int sa = (a > 0) - (a < 0);
+    int sb = (b > 0) - (b < 0);
+
+    if ((ax + ay) * (ax + ay) < 2 * ax * ax)
+        sb = 0;
+    if ((ax + ay) * (ax + ay) < 2 * ay * ay)
+        sa = 0;
+    return dirs[sa + 1][sb + 1];
+}
+
+// Direction of the sound from sender as heard by receiver, 0 on its tile
+static inline int compute_direction(const map_t *map, const player_t *sender,
+    const player_t *receiver)
+{
+    int direction = octant_direction(
+        torus_delta(sender->x - receiver->x, map->width),
+        -torus_delta(sender->y - receiver->y, map->height));
+    int orient = receiver->orientation;
+
+    if (direction == 0)
+        return 0;
+    orient = (orient < 1 || orient > 4) ? 1 : orient;
+    return ((direction - 1 + 2 * (orient - 1)) % 8) + 1;
 }
 
+// The text is formatted once, only the direction digit changes per receiver
 static inline void send_broadcast_to_ai(server_t *server,
     client_t *sender_client, player_t *sender, const char *msg)
 {
     char *ai_msg = NULL;
-    int orient;
     client_t *other;
 
     send_response(sender_client, "ok\n");
+    if (asprintf(&ai_msg, "message 0, %s\n", msg) < 0 || !ai_msg)
+        return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        other = &server->clients[i];
+        other = server->clients[i];
         if (other->type != CLIENT_TYPE_AI || !other->player ||
-            other->fd == sender_client->fd)
-            continue;
-        orient = other->player->orientation;
-        if (asprintf(&ai_msg, "message %d, %s\n", compute_direction((int[2])
-            {(sender->x - other->player->x),
-            (sender->y - other->player->y)}, server->game->map->width,
-            server->game->map->height, orient), msg) < 0 || !ai_msg)
+            other == sender_client)
             continue;
+        ai_msg[BROADCAST_DIGIT] = '0' + compute_direction(server->game->map,
+            sender, other->player);
         send_response(other, ai_msg);
-        free(ai_msg);
     }
+    free(ai_msg);
 }
 
 static inline void ai_action_broadcast(server_t *server, client_t *client,
@@ -114,14 +106,14 @@ static inline void ai_action_broadcast(server_t *server, client_t *client,
 {
     player_t *sender = client ? client->player : NULL;
 
-    printf("Broadcasting message: %s\n", msg);
+    LOG_DEBUG("Broadcasting message: %s", msg);
     if (!server || !client || !msg || !sender) {
         send_response(client, "ko\n");
         return;
     }
     send_broadcast_to_ai(server, client, sender, msg);
     helper_send_pbc(server, client, sender, msg);
-    printf("Broadcasting message done: %s\n", msg);
+    LOG_DEBUG("Broadcasting message done: %s", msg);
 }
 
 #endif
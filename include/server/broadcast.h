@@ -14,6 +14,7 @@ void broadcast_string_message_to_guis(server_t *server, const char *message);
 void broadcast_message_to_guis(server_t *server, player_t *player,
     char *(*function)(client_t *, const player_t *));
 void broadcast_tile_to_guis(server_t *server, int x, int y);
+void broadcast_dirty_tiles(server_t *server);
 void broadcast_player_resource_update(server_t *server, player_t *player,
     int resource_id, char *(*function)(const player_t *, int));
 
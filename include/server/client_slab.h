@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/client_slab.h
+** File description:
+** Slab storage for client slots
+*/
+
+#ifndef CLIENT_SLAB_H_
+    #define CLIENT_SLAB_H_
+
+    #include "server/server.h"
+
+// Clients live in slabs of CLIENT_SLAB_SIZE entries that are never moved,
+// so a client_t pointer and its slot index stay valid for the whole
+// connection. server->clients is a dense list of the active clients,
+// kept parallel to server->poll_fds: the listeners come first and client i
+// polls at index i + listener_count.
+
+// Takes a free slot (growing the slabs if needed) and appends it to the
+// active list; returns NULL once max_clients is reached
+client_t *client_slot_acquire(server_t *server);
+
+// Swap-removes the client from the active list and recycles its slot
+void client_slot_release(server_t *server, client_t *client);
+
+client_t *client_from_slot(const server_t *server, size_t slot);
+void client_storage_destroy(server_t *server);
+
+#endif /* !CLIENT_SLAB_H_ */
@@ -0,0 +1,33 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/command_hash.h
+** File description:
+** Perfect hash of protocol command names
+*/
+
+#ifndef COMMAND_HASH_H_
+    #define COMMAND_HASH_H_
+
+    #include <stdbool.h>
+    #include <stddef.h>
+
+    #define COMMAND_SLOTS 32
+    // Collision-free for both tables: AI commands key on their first and
+    // fourth characters, GUI commands on their first two. Adding a command
+    // means checking its slot is still free.
+    #define COMMAND_SLOT(first, key) ((((unsigned char)(first)) * 9u + \
+        (unsigned char)(key)) & (COMMAND_SLOTS - 1))
+    #define AI_KEY_INDEX 3
+    #define GUI_KEY_INDEX 1
+
+// Reading cmd[index] is only safe when no earlier character ends the line
+static inline bool command_has_key(const char *cmd, size_t index)
+{
+    for (size_t i = 0; i < index; ++i) {
+        if (cmd[i] == '\0')
+            return false;
+    }
+    return true;
+}
+
+#endif /* !COMMAND_HASH_H_ */
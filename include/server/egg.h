@@ -11,49 +11,91 @@
     #include <stdbool.h>
 
     #include "server/server.h"
-    #include "dynamic_array.h"
-    #include "string.h"
 
+    #define EGG_POOL_SLAB 64
+
+// next/prev link the egg into its team's unhatched list, then into the
+// hatched one while it waits for a client
 typedef struct egg_s {
     int id;
-    char *team_name;
+    int team_id;
     int x;
     int y;
     bool hatched;
     bool connected;
+    struct egg_s *next;
+    struct egg_s *prev;
 } egg_t;
 
+// laid counts every egg of the team still on the map, hatched or not
+typedef struct team_eggs_s {
+    egg_t *unhatched;
+    egg_t *hatched;
+    size_t hatched_count;
+    size_t laid_count;
+} team_eggs_t;
+
+static inline void egg_list_push(egg_t **head, egg_t *egg)
+{
+    egg->prev = NULL;
+    egg->next = *head;
+    if (*head)
+        (*head)->prev = egg;
+    *head = egg;
+}
+
+static inline void egg_list_unlink(egg_t **head, egg_t *egg)
+{
+    if (egg->prev)
+        egg->prev->next = egg->next;
+    else
+        *head = egg->next;
+    if (egg->next)
+        egg->next->prev = egg->prev;
+    egg->next = NULL;
+    egg->prev = NULL;
+}
+
 // Create a new egg on the map at the player's position
 egg_t *create_egg(server_t *server, player_t *parent);
 
-// Handle egg hatching (when the timer expires)
+// Handle egg hatching: the egg joins its team's list of connectable eggs
 void hatch_egg(server_t *server, egg_t *egg);
 
-// Free and clean up an egg when it dies
+// Give an egg back to the pool once it is off the manager's books
 void egg_die(server_t *server, egg_t *egg);
 
 // Function prototypes for egg management
-egg_t *egg_manager_find_available_egg(server_t *server, const char *team_name);
-void egg_manager_remove_egg(server_t *server, egg_t *egg);
-size_t egg_manager_get_available_count(server_t *server,
-    const char *team_name);
+int egg_manager_init(server_t *server);
+void egg_manager_destroy(server_t *server);
 egg_t *egg_manager_add_egg(server_t *server, player_t *parent);
-void egg_die(server_t *server, egg_t *egg);
-egg_t *create_egg(server_t *server, player_t *parent);
+egg_t *egg_manager_find_available_egg(server_t *server, int team_id);
+void egg_manager_remove_egg(server_t *server, egg_t *egg);
+
+static inline team_eggs_t *egg_manager_team(const server_t *server,
+    int team_id)
+{
+    if (!server->team_eggs || team_id < 0 ||
+        (size_t)team_id >= server->config.team_count)
+        return NULL;
+    return &server->team_eggs[team_id];
+}
+
+// Hatched eggs no client has taken yet
+static inline size_t egg_manager_get_available_count(const server_t *server,
+    int team_id)
+{
+    team_eggs_t *team = egg_manager_team(server, team_id);
+
+    return team ? team->hatched_count : 0;
+}
 
 static inline int egg_manager_count_eggs(const server_t *server,
-    char const *team_name)
+    int team_id)
 {
-    int count = 0;
-
-    if (!server || !server->eggs)
-        return 0;
-    for (size_t i = 0; i < DA_LEN(server->eggs); ++i) {
-        if (strcmp(server->eggs[i]->team_name, team_name) == 0) {
-            count++;
-        }
-    }
-    return count;
+    team_eggs_t *team = egg_manager_team(server, team_id);
+
+    return team ? (int)team->laid_count : 0;
 }
 
 #endif // EGG_H
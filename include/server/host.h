@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/host.h
+** File description:
+** Several independent games behind one set of listeners
+*/
+
+#ifndef HOST_H_
+    #define HOST_H_
+
+    #include "server/server.h"
+
+    #define HOST_MAX_GAMES 256
+    #define LOBBY_LINE_MAX 256
+    #define LOBBY_COMMAND "GAME "
+    #define HOST_POLL_INTERVAL 0.05
+    #define LOBBY_TIMEOUT 10.0
+    #define LOBBY_FD_SHARE 4
+
+// With --games N the process owns the listeners and runs N game slots, each
+// a full server_t (map, teams, clock, clients, pools) on its own thread.
+// New connections wait in the lobby: after WELCOME, "GAME k" sends the
+// client to slot k, a team name to the first slot whose game has a seat
+// left in that team and GRAPHIC to slot 0. The lobby reads only that line,
+// everything after it is read by the game. A connection that has not been
+// routed within LOBBY_TIMEOUT seconds is closed, and the lobby holds at
+// most 1 / LOBBY_FD_SHARE of the descriptor limit. A slot whose game is
+// won starts a fresh one with the next seed, so a tournament streams
+// through the slots.
+
+// Runs until a shutdown signal, returns -1 when nothing could be started
+int host_run(const server_config_t *config);
+
+// Game thread side, server->host is set. host_game_publish tells the lobby
+// how many players each team can still take, it runs after every tick and
+// every batch of adopted clients.
+int host_game_listener(host_game_t *game);
+void host_game_adopt(server_t *server);
+void host_game_publish(const server_t *server);
+bool host_game_stopping(const server_t *server);
+
+#endif /* !HOST_H_ */
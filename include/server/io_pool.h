@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/io_pool.h
+** File description:
+** Optional I/O threads owning the client sockets
+*/
+
+#ifndef IO_POOL_H_
+    #define IO_POOL_H_
+
+    #include "server/server.h"
+
+    #define IO_MAX_THREADS 64
+    #define IO_INBOUND_SLOTS 16384
+    #define IO_OUTBOUND_SLOTS 8192
+    #define IO_INLINE_SIZE 192
+    #define IO_MAX_PENDING 1048576
+
+// With --io-threads N, client i is owned by I/O thread (slot % N) which
+// reads, splits and checks its lines and pushes them to one inbound queue.
+// The game thread still runs every command itself, in arrival order, so the
+// simulation stays single-threaded; its replies travel back through a
+// per-thread outbound queue. Each message carries the client's slot and
+// generation so nothing stale is ever delivered to a recycled slot.
+
+// Leaves server->io NULL when config.io_threads is 0
+int io_pool_create(server_t *server);
+void io_pool_destroy(server_t *server);
+
+// Game thread side, only valid for clients with client->io set
+void io_pool_attach(server_t *server, client_t *client);
+void io_pool_send(client_t *client, const char *data, size_t len);
+void io_pool_detach(client_t *client);
+
+// Replaces the client poll of the single-threaded loop: accepts pending
+// connections then runs every line received since the previous call
+int io_pool_poll(server_t *server, const struct timespec *timeout);
+
+// Messages waiting for the game thread, and for I/O thread i
+size_t io_pool_inbound_depth(const server_t *server);
+size_t io_pool_outbound_depth(const server_t *server, size_t i);
+
+#endif /* !IO_POOL_H_ */
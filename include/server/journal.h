@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/journal.h
+** File description:
+** Append-only binary journal of the game events
+*/
+
+#ifndef JOURNAL_H_
+    #define JOURNAL_H_
+
+    #include "server/server.h"
+
+    #define JOURNAL_MAGIC 0x4C4E4A5AU
+    #define JOURNAL_VERSION 1
+    #define JOURNAL_KEYFRAME_EVERY 1000
+    #define JOURNAL_RING_SLOTS 16384
+    #define JOURNAL_BUFFER_SIZE 1048576
+
+// File layout, native little-endian: u32 magic, u32 version, then records
+//   u32 size of what follows, u8 event, u64 tick, payload
+// Payloads, coordinates and stacks as u16, ids and inventories as u32:
+//   KEYFRAME  u64 offset of the previous keyframe (0: none), then a whole
+//             snapshot image as written by --snapshot
+//   END       u64 offset of the last keyframe, written on a clean close
+//   PNW PPO PIN PLV PDI   id, x, y, u8 orientation, u8 level, u16 team,
+//                         RESOURCE_COUNT inventory counts
+//   BCT       x, y, RESOURCE_COUNT stacks
+//   PIC PIE   x, y, initiator id, u8 level, u8 result (1: success)
+//   ENW       egg id, parent id, x, y
+//   EBO EDI   egg id
+//   SEG       u16 winning team
+// Digestion is not recorded, it follows from the keyframe's food counters.
+typedef enum journal_event_e {
+    JOURNAL_KEYFRAME,
+    JOURNAL_END,
+    JOURNAL_PNW,
+    JOURNAL_PPO,
+    JOURNAL_PIN,
+    JOURNAL_PLV,
+    JOURNAL_PDI,
+    JOURNAL_BCT,
+    JOURNAL_PIC,
+    JOURNAL_PIE,
+    JOURNAL_ENW,
+    JOURNAL_EBO,
+    JOURNAL_EDI,
+    JOURNAL_SEG,
+} journal_event_t;
+
+// With --journal, events are put in a lock-free ring by the game thread,
+// or held by the tick batch that ran them (tick_capture_record), and a
+// background thread appends them to the file. A
+// keyframe is taken at open and every --keyframe-every ticks, so any tick
+// is rebuilt from the keyframe before it and the records that follow.
+int journal_open(server_t *server);
+void journal_close(server_t *server);
+void journal_tick(server_t *server);
+
+// A record held back by tick_capture_record, published once its parallel
+// batch is over so the journal keeps the serial order
+void journal_publish(server_t *server, const void *record);
+
+// Every call is a no-op without --journal
+void journal_player(server_t *server, journal_event_t event,
+    const player_t *player);
+void journal_tile(server_t *server, tile_id_t tile);
+void journal_incantation(server_t *server, journal_event_t event,
+    const player_t *initiator, bool success);
+void journal_egg(server_t *server, journal_event_t event, int egg_id,
+    const player_t *parent);
+void journal_game_end(server_t *server, int team_id);
+
+#endif /* !JOURNAL_H_ */
@@ -11,6 +11,10 @@
     #include "server/server.h"
 
 void consume_food(client_t *client);
+
+// One tick of digestion for a live player, touches nothing but the player.
+// Returns true when it has starved and player_die is due.
+bool player_digest(player_t *player);
 void player_die(client_t *client, server_t *server);
 void fork_player(client_t *client, map_t *map);
 
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/logger.h
+** File description:
+** Leveled asynchronous logger
+*/
+
+#ifndef LOGGER_H_
+    #define LOGGER_H_
+
+    #include <stdbool.h>
+
+    #define LOG_RING_SLOTS 4096
+    #define LOG_MESSAGE_SIZE 240
+
+typedef enum log_level_e {
+    LOG_LEVEL_DEBUG,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_NONE
+} log_level_t;
+
+// Read by the LOG_* macros so a filtered message costs a single compare
+extern log_level_t g_log_level;
+
+    #define LOG_ON(lvl) ((lvl) >= g_log_level)
+    #define LOG_AT(lvl, ...) (LOG_ON(lvl) ? log_write(lvl, __VA_ARGS__) : 0)
+    #define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+    #define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+    #define LOG_WARN(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+    #define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+// Starts the background writer; messages logged before this call or after
+// log_shutdown are written synchronously
+int log_init(log_level_t level);
+void log_shutdown(void);
+
+// Formats straight into a ring slot, never blocks (drops when full)
+int log_write(log_level_t level, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+// Returns -1 when name is not one of debug, info, warn, error, none
+int log_level_from_string(const char *name, log_level_t *level);
+
+#endif /* !LOGGER_H_ */
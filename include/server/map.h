@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/map.h
+** File description:
+** Compact tile storage: per-type resource stacks and sparse occupancy
+*/
+
+#ifndef MAP_H_
+    #define MAP_H_
+
+    #include "server/server.h"
+
+    #define TILE_NONE UINT32_MAX
+    #define TILE_STACK_MAX UINT16_MAX
+    #define OCCUPANCY_MIN_SLOTS 64
+    #define DIRTY_MIN_CAPACITY 1024
+    #define MAP_HUGE_PAGE (2 * 1024 * 1024)
+
+// Returns TILE_NONE outside the map
+static inline tile_id_t map_tile_at(const map_t *map, int x, int y)
+{
+    if (!map || x < 0 || y < 0 || x >= map->width || y >= map->height)
+        return TILE_NONE;
+    return (tile_id_t)y * map->width + x;
+}
+
+// Any coordinates, wrapped around the torus
+static inline tile_id_t map_wrap_tile(const map_t *map, int x, int y)
+{
+    x %= map->width;
+    y %= map->height;
+    return map_tile_at(map, x < 0 ? x + map->width : x,
+        y < 0 ? y + map->height : y);
+}
+
+static inline int tile_x(const map_t *map, tile_id_t tile)
+{
+    return (int)(tile % map->width);
+}
+
+static inline int tile_y(const map_t *map, tile_id_t tile)
+{
+    return (int)(tile / map->width);
+}
+
+static inline int map_stack(const map_t *map, tile_id_t tile, int type)
+{
+    return map->stacks[(size_t)type * map->tile_count + tile];
+}
+
+// The occupancy slot of the tile, NULL when nobody stands on it
+const occupancy_t *map_occupancy(const map_t *map, tile_id_t tile);
+
+// Creates the slot when missing, NULL only when the table cannot grow.
+// The pointer is valid until the next occupy or vacate.
+occupancy_t *map_occupy(map_t *map, tile_id_t tile);
+
+// Frees the slot, which must have no occupant left
+void map_vacate(map_t *map, occupancy_t *slot);
+
+static inline player_t *map_occupants(const map_t *map, tile_id_t tile)
+{
+    const occupancy_t *slot = map_occupancy(map, tile);
+
+    return slot ? slot->head : NULL;
+}
+
+static inline size_t map_player_count(const map_t *map, tile_id_t tile)
+{
+    const occupancy_t *slot = map_occupancy(map, tile);
+
+    return slot ? slot->count : 0;
+}
+
+#endif /* !MAP_H_ */
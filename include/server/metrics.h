@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/metrics.h
+** File description:
+** Performance counters served on the admin socket
+*/
+
+#ifndef METRICS_H_
+    #define METRICS_H_
+
+    #include <poll.h>
+
+    #include "server/server.h"
+
+    #define METRICS_BUCKETS 24
+    #define METRICS_ADMIN_TIMEOUT_MS 1000
+    #define METRICS_REQUEST_SIZE 64
+    #define METRICS_ADMIN_EVENTS (POLLIN | POLLOUT | POLLHUP | POLLERR)
+
+// TICK is the whole step, the others its phases, POLL the handling of
+// ready sockets after the wait. Histogram bucket 0 counts durations under
+// 1 us, bucket b >= 1 those in [2^(b-1), 2^b) us, the last one the rest.
+typedef enum metrics_phase_e {
+    METRICS_TICK,
+    METRICS_POLL,
+    METRICS_ACTIONS,
+    METRICS_RESPAWN,
+    METRICS_FOOD,
+    METRICS_TILES,
+    METRICS_WIN,
+    METRICS_PHASES
+} metrics_phase_t;
+
+// With --admin path, a client connecting to the unix socket path and
+// sending "json", or "text" or nothing, gets one dump then the socket is
+// closed. The dump is sent as the connection drains, never blocking the
+// game; a reader stalled for METRICS_ADMIN_TIMEOUT_MS is dropped. Without
+// it server->metrics is NULL and every call is a no-op.
+int metrics_open(server_t *server);
+void metrics_close(server_t *server);
+
+// Timestamps in monotonic nanoseconds, 0 without --admin. A lap records
+// the time since started under phase and returns the current time, so
+// consecutive phases are chained on a single clock read each.
+uint64_t metrics_start(const server_t *server);
+uint64_t metrics_lap(server_t *server, metrics_phase_t phase,
+    uint64_t started);
+
+// Keeps the traffic of a client that is going away in the totals
+void metrics_retire(server_t *server, const client_t *client);
+
+// What to poll in the admin listener's place: the connection being
+// answered when there is one, for its request then for room to send the
+// dump. After the poll, metrics_admin_handle answers that slot and clears
+// its events, returning whether it had any. It runs before the POLL timer
+// starts, so queries are not counted as poll time.
+struct pollfd metrics_admin_pollfd(server_t *server);
+bool metrics_admin_handle(server_t *server, struct pollfd *pfd);
+
+#endif /* !METRICS_H_ */
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/mpsc_ring.h
+** File description:
+** Bounded lock-free multi-producer single-consumer ring of fixed slots
+*/
+
+#ifndef MPSC_RING_H_
+    #define MPSC_RING_H_
+
+    #include <stdatomic.h>
+    #include <stdbool.h>
+    #include <stddef.h>
+
+// Producers claim a slot, fill it in place and publish it; the single
+// consumer peeks the oldest published slot and releases it when done.
+// Each cell carries a sequence number so no lock is ever taken.
+typedef struct mpsc_ring_s {
+    unsigned char *cells;
+    size_t cell_size;
+    size_t slot_size;
+    size_t mask;
+    _Atomic size_t enqueue_pos;
+    _Atomic size_t dequeue_pos;
+} mpsc_ring_t;
+
+// slot_count must be a power of two
+int mpsc_ring_init(mpsc_ring_t *ring, size_t slot_count, size_t slot_size);
+void mpsc_ring_destroy(mpsc_ring_t *ring);
+
+// Returns the payload of a free slot, or NULL when the ring is full
+void *mpsc_ring_claim(mpsc_ring_t *ring, size_t *ticket);
+void mpsc_ring_publish(mpsc_ring_t *ring, size_t ticket);
+
+// Consumer side, must only ever be called from one thread
+void *mpsc_ring_peek(mpsc_ring_t *ring);
+void mpsc_ring_release(mpsc_ring_t *ring);
+
+// Slots claimed and not released yet, from any thread, for reporting only
+static inline size_t mpsc_ring_depth(mpsc_ring_t *ring)
+{
+    size_t dequeued = atomic_load_explicit(&ring->dequeue_pos,
+        memory_order_relaxed);
+
+    return atomic_load_explicit(&ring->enqueue_pos, memory_order_relaxed) -
+        dequeued;
+}
+
+#endif /* !MPSC_RING_H_ */
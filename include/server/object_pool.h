@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/object_pool.h
+** File description:
+** Fixed-size object pools backed by slabs and a free list
+*/
+
+#ifndef OBJECT_POOL_H_
+    #define OBJECT_POOL_H_
+
+    #include <stddef.h>
+
+    #define OBJECT_POOL_ALIGN 16
+
+typedef struct pool_node_s {
+    struct pool_node_s *next;
+} pool_node_t;
+
+// Slabs are never returned to the allocator before object_pool_destroy, so
+// the steady state does no malloc/free at all
+typedef struct object_pool_s {
+    const char *name;
+    size_t object_size;
+    size_t slab_objects;
+    void **slabs;
+    size_t slab_count;
+    pool_node_t *free_list;
+    size_t in_use;
+    size_t capacity;
+    size_t peak;
+    size_t allocations;
+} object_pool_t;
+
+int object_pool_init(object_pool_t *pool, const char *name,
+    size_t object_size, size_t slab_objects);
+
+// Objects come back zeroed, like calloc
+void *object_pool_alloc(object_pool_t *pool);
+void object_pool_free(object_pool_t *pool, void *object);
+
+// Occupancy: objects in use, slab capacity, high-water mark, total served
+void object_pool_log_stats(const object_pool_t *pool);
+void object_pool_destroy(object_pool_t *pool);
+
+#endif /* !OBJECT_POOL_H_ */
@@ -17,7 +17,8 @@ char *gui_payload_plv(client_t *, const player_t *player);
 char *gui_payload_pdi(client_t *, const player_t *player);
 
 /* Incantation payloads */
-char *gui_payload_pic(tile_t *tile, int level, player_t **players, int count);
+char *gui_payload_pic(const map_t *map, tile_id_t tile,
+    const player_t *initiator);
 char *gui_payload_pie_success(client_t *, const player_t *player);
 char *gui_payload_pie_failed(client_t *, const player_t *player);
 
@@ -28,19 +28,20 @@ typedef enum {
 } ai_action_type_t;
 
 
-static const double ai_action_duration[] = {
-    [AI_ACTION_FORWARD] = 7.0,
-    [AI_ACTION_RIGHT] = 7.0,
-    [AI_ACTION_LEFT] = 7.0,
-    [AI_ACTION_LOOK] = 7.0,
-    [AI_ACTION_INVENTORY] = 1.0,
-    [AI_ACTION_BROADCAST] = 7.0,
-    [AI_ACTION_CONNECT_NBR] = 0.0,
-    [AI_ACTION_FORK] = 42.0,
-    [AI_ACTION_EJECT] = 7.0,
-    [AI_ACTION_TAKE] = 7.0,
-    [AI_ACTION_SET] = 7.0,
-    [AI_ACTION_INCANTATION] = 300.0
+// In ticks
+static const uint64_t ai_action_duration[] = {
+    [AI_ACTION_FORWARD] = 7,
+    [AI_ACTION_RIGHT] = 7,
+    [AI_ACTION_LEFT] = 7,
+    [AI_ACTION_LOOK] = 7,
+    [AI_ACTION_INVENTORY] = 1,
+    [AI_ACTION_BROADCAST] = 7,
+    [AI_ACTION_CONNECT_NBR] = 0,
+    [AI_ACTION_FORK] = 42,
+    [AI_ACTION_EJECT] = 7,
+    [AI_ACTION_TAKE] = 7,
+    [AI_ACTION_SET] = 7,
+    [AI_ACTION_INCANTATION] = 300
 };
 
 typedef struct ai_action_data_s {
@@ -66,6 +67,9 @@ void protocol_handle_ai_command(server_t *server, client_t *client,
     const char *cmd);
 void create_and_queue_action(server_t *server, client_t *client,
     const char *cmd, const ai_action_type_t type);
+// Queues an action restored from a snapshot with the deadline it had
+int requeue_action(server_t *server, client_t *client, const char *cmd,
+    const ai_action_type_t type, uint64_t exec_tick);
 void ai_callback_handler(client_t *client, void *data);
 
 #endif /* !PROTOCOL_AI_H_ */
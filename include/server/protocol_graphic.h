@@ -9,15 +9,27 @@
     #define PROTOCOL_GRAPHIC_H_
 
     #include "server.h"
+    #include "server/command_hash.h"
+
+    // Same layout as AI_ENTRY, keyed on the first two characters
+    #define GUI_ENTRY(first, key, name, handler) \
+        [COMMAND_SLOT(first, key)] = {name, sizeof(name) - 1, handler}
 
 typedef void (*graphic_cmd_handler_t)(server_t *server, client_t *client,
     const char *cmd);
 
 typedef struct {
     const char *cmd;
+    size_t len;
     graphic_cmd_handler_t handler;
 } graphic_cmd_entry_t;
 
+// Indexed by COMMAND_SLOT of the name, empty slots have a NULL cmd
+extern const graphic_cmd_entry_t graphic_commands[COMMAND_SLOTS];
+
+// The entry whose name prefixes cmd, or NULL
+const graphic_cmd_entry_t *graphic_command_find(const char *cmd);
+
 void protocol_handle_graphic_command(server_t *server, client_t *client,
     const char *cmd);
 void protocol_send_map_size(server_t *server, client_t *client);
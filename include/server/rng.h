@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/rng.h
+** File description:
+** Seeded pseudo-random generator for the simulation
+*/
+
+#ifndef RNG_H_
+    #define RNG_H_
+
+    #include <stdint.h>
+
+    #define RNG_GAMMA 0x9e3779b97f4a7c15ULL
+    #define RNG_MIX1 0xbf58476d1ce4e5b9ULL
+    #define RNG_MIX2 0x94d049bb133111ebULL
+
+// xoshiro256**: four words of state, expanded from the seed with
+// splitmix64, so a seed fully determines every draw and two runs with the
+// same seed and inputs are identical
+typedef struct rng_s {
+    uint64_t s[4];
+} rng_t;
+
+void rng_seed(rng_t *rng, uint64_t seed);
+uint64_t rng_next(rng_t *rng);
+
+// Uniform in [0, bound), bound must be non-zero
+uint32_t rng_below(rng_t *rng, uint32_t bound);
+
+#endif /* !RNG_H_ */
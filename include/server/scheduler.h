@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/scheduler.h
+** File description:
+** Min-heap of the next due action of every client
+*/
+
+#ifndef SCHEDULER_H_
+    #define SCHEDULER_H_
+
+    #include <stdbool.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+typedef struct client_s client_t;
+
+// A client's actions are chained (each one starts when the previous one
+// ends), so only the head of its queue is ever in the heap. Ties on
+// exec_tick are broken by the order in which the actions were queued.
+typedef struct schedule_entry_s {
+    uint64_t exec_tick;
+    uint64_t seq;
+    client_t *client;
+} schedule_entry_t;
+
+typedef struct scheduler_s {
+    schedule_entry_t *entries;
+    size_t count;
+    size_t capacity;
+    uint64_t next_seq;
+} scheduler_t;
+
+// Inserts the client or moves it to match its current queue head, removes
+// it when its queue is empty
+int scheduler_update(scheduler_t *scheduler, client_t *client);
+void scheduler_remove(scheduler_t *scheduler, client_t *client);
+
+// Returns the client whose head action is due at tick, or NULL
+client_t *scheduler_peek_due(const scheduler_t *scheduler, uint64_t tick);
+void scheduler_destroy(scheduler_t *scheduler);
+
+#endif /* !SCHEDULER_H_ */
@@ -15,18 +15,35 @@
     #include <sys/poll.h>
     #include <time.h>
     #include <stdbool.h>
+    #include <sys/types.h>
 
     #include "shared/utils.h"
+    #include "server/logger.h"
+    #include "server/scheduler.h"
+    #include "server/object_pool.h"
+    #include "server/rng.h"
 
 //circular dependency bs
 typedef struct egg_s egg_t;
+typedef struct team_eggs_s team_eggs_t;
 
-    #define MAX_CLIENTS 100
+    #define CLIENT_SLAB_SIZE 64
+    #define RESERVED_FDS 16
+    #define MAX_FD_LIMIT 1048576
     #define BUFFER_SIZE 4096
+    #define MAX_LINE_LENGTH 8192
     #define MAX_COMMAND_QUEUE 50
     #define MIN_MAP_SIZE 6
-    #define MAX_MAP_SIZE 50
+    #define MAX_MAP_SIZE 2000
     #define FOOD_INHALATION_TIME 126
+    #define POLL_INTERVAL 0.002
+    #define ACTION_POOL_SLAB 256
+    #define MAX_TICK_CATCHUP 64
+    #ifdef DEBUG
+        #define MAP_CHECK_TOTALS(map) map_check_totals(map)
+    #else
+        #define MAP_CHECK_TOTALS(map) ((void)0)
+    #endif
 
 typedef enum client_type_e {
     CLIENT_TYPE_UNKNOWN,
@@ -46,9 +63,28 @@ typedef enum resource_type_e {
 } resource_type_t;
 
 typedef struct action_s action_t;
+typedef struct io_pool_s io_pool_t;
+typedef struct tick_pool_s tick_pool_t;
+typedef struct host_game_s host_game_t;
+typedef struct parked_player_s parked_player_t;
+typedef struct journal_s journal_t;
+typedef struct metrics_s metrics_t;
+typedef struct io_thread_s io_thread_t;
+
+// Lines received and replies sent, newlines included, see metrics.h
+typedef struct traffic_s {
+    uint64_t messages_in;
+    uint64_t bytes_in;
+    uint64_t messages_out;
+    uint64_t bytes_out;
+} traffic_t;
 
 typedef struct client_s {
     int fd;
+    size_t slot;
+    uint32_t generation;
+    io_thread_t *io;
+    size_t poll_index;
     client_type_t type;
     char *buffer;
     size_t buffer_size;
@@ -58,17 +94,23 @@ typedef struct client_s {
     action_t *action_queue_head;
     action_t *action_queue_tail;
     size_t action_queue_count;
+    size_t schedule_index;
     struct player_s *player;
+    bool players_sent;
+    traffic_t traffic;
 } client_t;
 
-typedef struct tile_s {
-    int resources[RESOURCE_COUNT];
-    struct player_s **players;
-    size_t player_count;
-    size_t player_capacity;
-    int x;
-    int y;
-} tile_t;
+// Tile (x, y) is y * width + x, see map.h
+typedef uint32_t tile_id_t;
+typedef uint16_t tile_stack_t;
+
+// Slot of the occupancy table, tile is TILE_NONE when the slot is free.
+// head starts an intrusive list threaded through player_t.
+typedef struct occupancy_s {
+    tile_id_t tile;
+    uint32_t count;
+    struct player_s *head;
+} occupancy_t;
 
 typedef struct player_s {
     int id;
@@ -77,19 +119,36 @@ typedef struct player_s {
     int orientation;
     int level;
     char *team_name;
+    int team_id;
     int resources[RESOURCE_COUNT];
-    double last_action_time;
     bool is_elevating;
-    double elevation_start_time;
+    uint64_t elevation_start_tick;
     client_t *client;
     size_t last_food_inhalation;
     bool is_alive;
+    tile_id_t tile;
+    struct player_s *tile_prev;
+    struct player_s *tile_next;
 } player_t;
 
+// Resources are stored per type, stacks[type * tile_count + tile], so a
+// tile costs RESOURCE_COUNT * sizeof(tile_stack_t) bytes. Only occupied
+// tiles have an entry in the occupancy hash table. totals is kept in sync
+// by map_add_resource, every change to tile resources goes through it.
+// Tiles changed during a tick are in dirty_tiles once, dirty_bits dedups.
 typedef struct map_s {
-    tile_t **tiles;
     int width;
     int height;
+    size_t tile_count;
+    tile_stack_t *stacks;
+    occupancy_t *occupancy;
+    size_t occupancy_slots;
+    size_t occupied;
+    int totals[RESOURCE_COUNT];
+    uint64_t *dirty_bits;
+    uint32_t *dirty_tiles;
+    size_t dirty_count;
+    size_t dirty_capacity;
 } map_t;
 
 typedef struct server_config_s {
@@ -101,55 +160,108 @@ typedef struct server_config_s {
     char **team_names;
     size_t team_count;
     bool refill_tiles;
+    log_level_t log_level;
+    size_t io_threads;
+    size_t tick_threads;
+    size_t games;
+    const char *unix_path;
+    const char *snapshot_path;
+    size_t snapshot_every;
+    const char *restore_path;
+    const char *journal_path;
+    size_t keyframe_every;
+    const char *admin_path;
+    uint64_t seed;
+    bool has_seed;
+    bool turbo;
 } server_config_t;
 
+// team_members counts the players of each team still in the game, dead or
+// not. team_levels is a team_count x TEAM_LEVEL_SLOTS histogram of the live
+// ones by level, see team.h.
 typedef struct game_state_s {
     map_t *map;
     player_t **players;
     size_t player_count;
     size_t player_capacity;
-    double current_time;
+    player_t **players_by_id;
+    size_t id_capacity;
     int next_player_id;
+    size_t team_count;
+    size_t *team_members;
+    size_t *team_levels;
 } game_state_t;
 
 typedef struct server_s {
     int server_fd;
+    int unix_fd;
+    int admin_fd;
+    size_t listener_count;
     int signal_fd;
     server_config_t config;
-    client_t *clients;
+    client_t **clients;
     size_t client_count;
+    size_t active_capacity;
+    client_t **client_slabs;
+    size_t slab_count;
     size_t client_capacity;
-    egg_t **eggs;
+    size_t *free_slots;
+    size_t max_clients;
+    object_pool_t egg_pool;
+    team_eggs_t *team_eggs;
+    int next_egg_id;
     struct pollfd *poll_fds;
     size_t poll_count;
     bool is_running;
     game_state_t *game;
-    size_t tick_count;
+    uint64_t tick_count;
+    double next_tick_time;
+    rng_t rng;
+    scheduler_t scheduler;
+    object_pool_t action_pool;
+    object_pool_t action_data_pool;
+    io_pool_t *io;
+    tick_pool_t *tick;
+    host_game_t *host;
+    pid_t snapshot_pid;
+    parked_player_t *parked;
+    size_t parked_count;
+    journal_t *journal;
+    metrics_t *metrics;
 } server_t;
 
 int server_create(server_t *server, const server_config_t *config);
+int server_create_hosted(server_t *server, const server_config_t *config,
+    host_game_t *host);
 void server_run(server_t *server);
 void server_destroy(server_t *server);
 int parse_arguments(int argc, const char **argv, server_config_t *config);
 int process_argument(const char **argv, int *i, int argc,
     server_config_t *config);
+int process_option_argument(const char **argv, int *i, int argc,
+    server_config_t *config);
 game_state_t *game_state_create(server_t *server,
     const server_config_t *config);
 void game_state_destroy(game_state_t *game);
-void game_state_update(server_t *server, double delta_time);
-void add_player_to_game(game_state_t *game, player_t *player);
+void game_state_update(server_t *server);
+int add_player_to_game(game_state_t *game, player_t *player);
 map_t *map_create(int width, int height);
 int allocate_map_tiles(map_t *map);
 void send_response(client_t *client, const char *response);
 void map_destroy(map_t *map);
-tile_t *map_get_tile(const map_t *map, int x, int y);
+void map_add_resource(map_t *map, tile_id_t tile, int type, int amount);
+void map_mark_dirty(map_t *map, tile_id_t tile);
+void map_reset_dirty(map_t *map);
+void map_check_totals(const map_t *map);
 player_t *player_create(client_t *, int x, int y, const char *team_name);
 void player_destroy(player_t *player);
 player_t *player_find_by_id(server_t *server, int id);
 void player_set_position(server_t *server, player_t *player, int x, int y);
+void player_remove_from_tile(map_t *map, player_t *player);
 double get_current_time(void);
 int client_add(server_t *server, int client_fd);
-void client_remove(server_t *server, size_t index);
+client_t *client_attach(server_t *server, int client_fd);
+void client_remove(server_t *server, client_t *client);
 client_t *client_find_by_fd(server_t *server, int fd);
 void client_authenticate(server_t *server, client_t *client,
     const char *message);
@@ -162,9 +274,15 @@ void protocol_send_tile_content(server_t *server, client_t *client,
     int x, int y);
 void protocol_send_player_info(client_t *client, const player_t *player);
 void network_handle_events(server_t *server, int ready_count);
+void network_accept_connections(server_t *server, int listen_fd);
+int unix_listener_create(const char *path);
+int tcp_listener_create(size_t port);
+void unix_listener_destroy(int fd, const char *path);
 int signal_handler_init(void);
 void signal_handler_cleanup(int signal_fd);
 int signal_handler_check(int signal_fd);
 void client_handle_message(server_t *server, client_t *client);
+void client_process_command(server_t *server, client_t *client,
+    const char *command);
 
 #endif /* !SERVER_H_ */
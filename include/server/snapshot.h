@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/snapshot.h
+** File description:
+** Binary snapshot of a game and restore at startup
+*/
+
+#ifndef SNAPSHOT_H_
+    #define SNAPSHOT_H_
+
+    #include <stdio.h>
+
+    #include "server/server.h"
+
+    #define SNAPSHOT_MAGIC 0x5350415AU
+    #define SNAPSHOT_VERSION 1
+    #define SNAPSHOT_TMP_SUFFIX ".tmp"
+    #define SNAPSHOT_BUFFER_SIZE 1048576
+
+// File layout, native little-endian, every section in this order:
+//   header   magic, version, width, height, team count, then each team
+//            name as u16 length + bytes
+//   clock    tick, next player id, next egg id, next action seq, rng state
+//   map      RESOURCE_COUNT * width * height u16 stacks, type-major
+//   players  u32 count, then the records below
+//   eggs     u32 count, then id, team, x, y, hatched
+//   trailer  FNV-1a 64 of everything before it
+// Tick stamps are stored relative to the snapshot tick, so a player keeps
+// the same time left on its actions however long it stays parked.
+typedef struct snapshot_action_s {
+    uint8_t type;
+    uint64_t delay;
+    char *arg;
+} snapshot_action_t;
+
+// A restored player waits here, off the map but holding its team seat,
+// until a client of its team connects and takes it over
+struct parked_player_s {
+    int id;
+    int x;
+    int y;
+    int orientation;
+    int level;
+    int team_id;
+    int resources[RESOURCE_COUNT];
+    bool is_elevating;
+    uint64_t elevation_age;
+    uint64_t food_counter;
+    snapshot_action_t *actions;
+    size_t action_count;
+};
+
+// With --snapshot, a child forked between two ticks writes the file so the
+// game thread only pays for fork(); at most one writer runs at a time.
+// snapshot_shutdown waits for it and writes the last one in place.
+void snapshot_tick(server_t *server);
+void snapshot_shutdown(server_t *server);
+
+// The whole image, trailer included, to any stream; -1 once a write failed
+int snapshot_serialize(const server_t *server, FILE *file);
+
+// --restore: map, players (parked), eggs and clock, -1 if the file is
+// unreadable, corrupt or made for another map size or team list
+int snapshot_restore(server_t *server, const char *path);
+
+// Hands a parked player of the team to a connecting client
+bool snapshot_resume(server_t *server, client_t *client, int team_id);
+void snapshot_parked_destroy(server_t *server);
+
+#endif /* !SNAPSHOT_H_ */
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/team.h
+** File description:
+** Team ids and per-team level histograms
+*/
+
+#ifndef TEAM_H_
+    #define TEAM_H_
+
+    #include "server/server.h"
+
+    #define TEAM_MAX_LEVEL 8
+    #define TEAM_LEVEL_SLOTS (TEAM_MAX_LEVEL + 1)
+    #define TEAM_WIN_LEVEL 8
+    #define TEAM_WIN_PLAYERS 6
+
+// A team id is the index of its name in config->team_names, -1 if unknown.
+// Names are only compared here, when a client or an egg enters the game.
+int team_find_id(const server_config_t *config, const char *name);
+int team_stats_init(game_state_t *game, size_t team_count);
+
+// delta is +1 when a live player enters the histogram, -1 when it dies or
+// leaves the game
+void team_track_player(game_state_t *game, const player_t *player,
+    int delta);
+void team_level_up(game_state_t *game, player_t *player);
+
+static inline void team_count_member(game_state_t *game,
+    const player_t *player, int delta)
+{
+    if (player->team_id >= 0 && (size_t)player->team_id < game->team_count)
+        game->team_members[player->team_id] += delta;
+}
+
+static inline size_t team_members_of(const game_state_t *game,
+    const player_t *player)
+{
+    if (player->team_id < 0 || (size_t)player->team_id >= game->team_count)
+        return 0;
+    return game->team_members[player->team_id];
+}
+
+static inline size_t team_level_count(const game_state_t *game,
+    int team_id, int level)
+{
+    return game->team_levels[team_id * TEAM_LEVEL_SLOTS + level];
+}
+
+#endif /* !TEAM_H_ */
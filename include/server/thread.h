@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/thread.h
+** File description:
+** Helper threads started with the signals left to the main thread
+*/
+
+#ifndef THREAD_H_
+    #define THREAD_H_
+
+    #include <pthread.h>
+
+// Starts routine(arg) with every signal blocked, so SIGINT and SIGTERM
+// are always delivered to the main thread and its shutdown flag. The
+// caller's mask is restored. Returns 0, or -1 when no thread was started.
+int thread_spawn_unsignaled(pthread_t *thread, void *(*routine)(void *),
+    void *arg);
+
+#endif /* !THREAD_H_ */
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** include/server/tick_pool.h
+** File description:
+** Optional worker pool running parts of a tick in parallel
+*/
+
+#ifndef TICK_POOL_H_
+    #define TICK_POOL_H_
+
+    #include "server/server.h"
+
+    #define TICK_MAX_THREADS 64
+    #define TICK_REGION_MIN 12
+    #define TICK_MIN_BATCH 32
+
+// With --tick-threads N the map is cut into regions of at least
+// TICK_REGION_MIN tiles a side, region r belonging to worker r % N (the
+// game thread is worker 0). The due actions of a tick are taken in their
+// serial order and split into batches at every action that can reach
+// outside one region or change the occupancy table: Forward, Broadcast,
+// Eject, Take, Set, Fork, Incantation, Connect_nbr, or a Look whose cone
+// crosses a border.
+// Inside a batch each worker runs its regions' actions in order, replies
+// are captured per action and sent in action order once the batch ends,
+// then the cross-region action runs alone. Journal records are held the
+// same way and published in action order. Digestion is split the same
+// way and deaths are applied in player order. Every client, GUI included,
+// therefore receives exactly what the serial tick would have sent.
+
+// Leaves server->tick NULL when config.tick_threads is below 2
+int tick_pool_create(server_t *server);
+void tick_pool_destroy(server_t *server);
+
+// Parallel counterparts of process_actions and game_state_update, which
+// they simply call when there is no pool
+void tick_pool_process_actions(server_t *server);
+void tick_pool_update_players(server_t *server);
+
+// Called by send_response: true when the text was kept for the current
+// action of a parallel batch instead of being sent
+bool tick_capture(client_t *client, const char *text);
+
+// Called by journal_begin: size bytes to fill with a record of the current
+// action of a parallel batch, handed to journal_publish when the batch
+// ends. NULL outside a batch, the record then goes straight to the ring.
+void *tick_capture_record(size_t size);
+
+#endif /* !TICK_POOL_H_ */
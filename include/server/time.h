@@ -12,17 +12,24 @@
 
     #include "server/server.h"
 
+    #define ACTION_ARG_SIZE 64
+
+// Actions and their data come from the server's object pools; command
+// points at inline_command unless the argument did not fit there
 typedef struct action_s {
     char *command;
-    double exec_time;
+    uint64_t exec_tick;
+    uint64_t seq;
     void (*callback)(client_t *client, void *data);
     void *data;
     struct action_s *next;
+    char inline_command[ACTION_ARG_SIZE];
 } action_t;
 
 double get_time_unit(server_t *server);
 bool set_time_unit(server_t *server, double time_unit);
-void queue_action(client_t *client, action_t *action);
+void queue_action(server_t *server, client_t *client, action_t *action);
 void process_actions(server_t *server);
+void action_release(server_t *server, action_t *action);
 
 #endif // TIME_H
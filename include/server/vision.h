@@ -10,16 +10,25 @@
 
     #include "server/server.h"
 
-char *vision_look(client_t *client, map_t *map);
+    #define VISION_MAX_LEVEL 8
+    #define VISION_MAX_CELLS ((VISION_MAX_LEVEL + 1) * (VISION_MAX_LEVEL + 1))
+    #define VISION_ITEM_SIZE 16
+
+typedef struct vision_offset_s {
+    int dx;
+    int dy;
+} vision_offset_t;
+
+// What a Look needs from one cell, read once from the map
+typedef struct vision_cell_s {
+    bool occupied;
+    int stacks[RESOURCE_COUNT];
+} vision_cell_t;
 
-struct vision_loop_s {
-    int *x;
-    int *y;
-    int dist;
-    int offset;
-    int orientation;
-    player_t *player;
-    map_t *map;
-};
+// Builds the per-orientation offset tables, once per process
+void vision_init(void);
+
+// Returns a malloc'd "[tile,tile,...]\n" line, NULL on allocation failure
+char *vision_look(client_t *client, map_t *map);
 
 #endif // VISION_H
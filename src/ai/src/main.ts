@@ -1,6 +1,7 @@
 import { AIPlayer } from "./core/AiPlayer";
 import { AIConfig } from "./core/types";
 import { logger } from "./logger";
+import { UNIX_HOST_PREFIX } from "./network/ConnectionManager";
 
 interface ParseResult {
     success: boolean;
@@ -111,7 +112,10 @@ class ZappyAI {
     }
 
     private isValidConfig(config: Partial<AIConfig>): config is AIConfig {
-        return !!(config.port && config.teamName);
+        if (config.port === undefined && config.host?.startsWith(UNIX_HOST_PREFIX)) {
+            config.port = 0;
+        }
+        return !!(config.port !== undefined && config.teamName);
     }
 
     private async startAI(config: AIConfig): Promise<void> {
@@ -154,6 +158,7 @@ class ZappyAI {
         console.log("  -p port        Port number (required)");
         console.log("  -n name        Name of the team (required)");
         console.log("  -h machine     Name of the machine (default: localhost)");
+        console.log("                 or unix:/path for a local server (-p optional)");
         console.log("  help           Show this help message");
         console.log("");
         console.log("Example:");
@@ -4,6 +4,8 @@ import { logger } from "../logger";
 import { GameState } from "./types";
 import { MessageParser, HandshakeMessage } from "./MessageParser";
 
+export const UNIX_HOST_PREFIX = "unix:";
+
 export class ConnectionManager extends EventEmitter {
     private socket: net.Socket;
     private host: string;
@@ -95,7 +97,12 @@ export class ConnectionManager extends EventEmitter {
 
     public connect(): Promise<void> {
         return new Promise((resolve, reject) => {
-            this.socket.connect(this.port, this.host, () => resolve());
+            if (this.host.startsWith(UNIX_HOST_PREFIX)) {
+                const path = this.host.slice(UNIX_HOST_PREFIX.length);
+                this.socket.connect({ path }, () => resolve());
+            } else {
+                this.socket.connect(this.port, this.host, () => resolve());
+            }
             this.socket.on("error", reject);
         });
     }
@@ -8,6 +8,7 @@
 #include "ArgumentValidator.hpp"
 #include "../network/NetworkManager.hpp"
 #include "../interfaces/INetworkClient.hpp"
+#include "Constants.hpp"
 #include <iostream>
 #include <cstring>
 #include <cstdlib>
@@ -19,7 +20,7 @@ ArgumentValidator::Arguments ArgumentValidator::parseArguments(int argc, char**
 {
     Arguments args;
 
-    if (argc < 5) {
+    if (argc < 3) {
         args.errorMessage = "Missing required arguments. GUI requires both port and machine.";
         return args;
     }
@@ -58,7 +59,7 @@ ArgumentValidator::Arguments ArgumentValidator::parseArguments(int argc, char**
         return args;
     }
 
-    if (args.port == 0) {
+    if (args.port == 0 && !isUnixHost(args.host)) {
         args.errorMessage = "Missing required argument: -p port";
         return args;
     }
@@ -113,6 +114,7 @@ void ArgumentValidator::printHelp(const char* programName)
     std::cout << "  option\tdescription" << std::endl;
     std::cout << "  -p port\tport number (1024-65535)" << std::endl;
     std::cout << "  -h machine\thostname or IP address of the server" << std::endl;
+    std::cout << "  \t\tor unix:/path for a local server (-p is then optional)" << std::endl;
     std::cout << std::endl;
     std::cout << "The GUI requires a valid connection to the Zappy server." << std::endl;
     std::cout << "Connection will be tested before starting the interface." << std::endl;
@@ -123,8 +125,23 @@ bool ArgumentValidator::isValidPort(int port)
     return port >= 1024 && port <= 65535;
 }
 
+bool ArgumentValidator::isUnixHost(const std::string& host)
+{
+    return host.rfind(zappy::constants::UNIX_HOST_PREFIX, 0) == 0;
+}
+
+std::string ArgumentValidator::unixSocketPath(const std::string& host)
+{
+    return host.substr(std::strlen(zappy::constants::UNIX_HOST_PREFIX));
+}
+
 bool ArgumentValidator::isValidHostname(const std::string& host)
 {
+    if (isUnixHost(host)) {
+        std::string path = unixSocketPath(host);
+        return !path.empty() && path.length() < zappy::constants::UNIX_PATH_MAX;
+    }
+
     if (host.empty() || host.length() > 255) {
         return false;
     }
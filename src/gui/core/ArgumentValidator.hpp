@@ -27,6 +27,8 @@ public:
     static Arguments parseArguments(int argc, char** argv);
     static bool validateConnection(const std::string& host, int port);
     static void printHelp(const char* programName);
+    static bool isUnixHost(const std::string& host);
+    static std::string unixSocketPath(const std::string& host);
 
 private:
     static bool isValidPort(int port);
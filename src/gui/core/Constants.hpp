@@ -32,6 +32,8 @@ constexpr int DEFAULT_PORT = 4242;
 constexpr const char* DEFAULT_HOST = "localhost";
 constexpr int NETWORK_BUFFER_SIZE = 1024;
 constexpr int NETWORK_TIMEOUT_US = 100000;
+constexpr const char* UNIX_HOST_PREFIX = "unix:";
+constexpr size_t UNIX_PATH_MAX = 108;
 
 // Audio settings
 constexpr float DEFAULT_VOLUME = 0.7f;
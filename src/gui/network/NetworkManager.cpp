@@ -7,6 +7,7 @@
 
 #include "NetworkManager.hpp"
 #include "../core/Constants.hpp"
+#include "../core/ArgumentValidator.hpp"
 #include <iostream>
 #include <cstring>
 #include <memory>
@@ -229,11 +230,41 @@ void NetworkManager::sendAuthenticationMessage() {
 }
 
 bool NetworkManager::createSocket() {
+#ifndef _WIN32
+    if (ArgumentValidator::isUnixHost(_host)) {
+        _socket = socket(AF_UNIX, SOCK_STREAM, 0);
+        return _socket != INVALID_SOCKET_VALUE;
+    }
+#endif
     _socket = socket(AF_INET, SOCK_STREAM, 0);
     return _socket != INVALID_SOCKET_VALUE;
 }
 
+bool NetworkManager::connectUnixSocket() {
+#ifndef _WIN32
+    std::string path = ArgumentValidator::unixSocketPath(_host);
+    struct sockaddr_un serverAddr;
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.sun_family = AF_UNIX;
+    strncpy(serverAddr.sun_path, path.c_str(), sizeof(serverAddr.sun_path) - 1);
+
+    int result = connect(_socket, reinterpret_cast<struct sockaddr*>(&serverAddr), sizeof(serverAddr));
+    if (result != 0) {
+        std::cerr << "Failed to connect: " << zappy::network::NetworkPlatform::getErrorString(getLastError()) << std::endl;
+        return false;
+    }
+    return true;
+#else
+    std::cerr << "Unix sockets are not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
 bool NetworkManager::connectSocket() {
+    if (ArgumentValidator::isUnixHost(_host)) {
+        return connectUnixSocket();
+    }
+
     struct hostent* hostEntry = gethostbyname(_host.c_str());
     if (!hostEntry) {
         std::cerr << "Failed to resolve hostname: " << _host << std::endl;
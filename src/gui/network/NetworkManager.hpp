@@ -78,6 +78,7 @@ private:
     
     bool createSocket();
     bool connectSocket();
+    bool connectUnixSocket();
     void closeSocket() noexcept;
     void sendData(const std::string& data);
     std::string receiveData();
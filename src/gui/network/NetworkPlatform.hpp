@@ -28,6 +28,7 @@
     inline void cleanupNetworking() { WSACleanup(); }
 #else
     #include <sys/socket.h>
+    #include <sys/un.h>
     #include <netinet/in.h>
     #include <netdb.h>
     #include <unistd.h>
@@ -19,6 +19,18 @@ static int parse_numeric_arg(const char **argv, int *i, size_t *value)
     return (*value > 0) ? 0 : -1;
 }
 
+// Team ids are indices into team_names, two equal names would share one
+static bool has_duplicate_team(const char **names, int count)
+{
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            if (strcmp(names[i], names[j]) == 0)
+                return true;
+        }
+    }
+    return false;
+}
+
 static int parse_team_names(const char **argv, int *i, int argc,
     server_config_t *config)
 {
@@ -29,7 +41,7 @@ static int parse_team_names(const char **argv, int *i, int argc,
         count++;
         (*i)++;
     }
-    if (count == 0)
+    if (count == 0 || has_duplicate_team(&argv[start], count))
         return -1;
     config->team_names = (char **)&argv[start];
     config->team_count = count;
@@ -104,5 +116,5 @@ int process_argument(const char **argv, int *i, int argc,
         return process_teams_arg(argv, i, argc, config);
     if (strcmp(argv[*i], "-r") == 0)
         return process_refill_arg(argv, i, config);
-    return -1;
+    return process_option_argument(argv, i, argc, config);
 }
@@ -0,0 +1,185 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/args/argument_options.c
+** File description:
+** Long command line options processing
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/server.h"
+#include "server/io_pool.h"
+#include "server/tick_pool.h"
+#include "server/host.h"
+
+typedef int (*option_handler_t)(const char **argv, int *i, int argc,
+    server_config_t *config);
+
+typedef struct {
+    const char *name;
+    option_handler_t handler;
+} option_entry_t;
+
+static int process_log_level_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    if (*i + 1 >= argc)
+        return -1;
+    if (log_level_from_string(argv[*i + 1], &config->log_level) == -1)
+        return -1;
+    (*i)++;
+    return 0;
+}
+
+// A decimal count of threads, games or ticks
+static int parse_count(const char **argv, int *i, int argc,
+    size_t *count)
+{
+    char *end;
+
+    if (*i + 1 >= argc || argv[*i + 1][0] == '-')
+        return -1;
+    *count = strtoul(argv[*i + 1], &end, 10);
+    if (*end != '\0' || end == argv[*i + 1])
+        return -1;
+    (*i)++;
+    return 0;
+}
+
+// A number of ticks between two periodic jobs, which cannot be 0
+static int parse_tick_interval(const char **argv, int *i, int argc,
+    size_t *interval)
+{
+    if (parse_count(argv, i, argc, interval) == -1)
+        return -1;
+    return *interval == 0 ? -1 : 0;
+}
+
+static int process_io_threads_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    if (parse_count(argv, i, argc, &config->io_threads) == -1)
+        return -1;
+    return config->io_threads > IO_MAX_THREADS ? -1 : 0;
+}
+
+static int process_tick_threads_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    if (parse_count(argv, i, argc, &config->tick_threads) == -1)
+        return -1;
+    return config->tick_threads > TICK_MAX_THREADS ? -1 : 0;
+}
+
+static int process_games_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    if (parse_count(argv, i, argc, &config->games) == -1)
+        return -1;
+    return config->games > HOST_MAX_GAMES ? -1 : 0;
+}
+
+static int parse_path(const char **argv, int *i, int argc,
+    const char **path)
+{
+    if (*i + 1 >= argc || argv[*i + 1][0] == '\0')
+        return -1;
+    *path = argv[*i + 1];
+    (*i)++;
+    return 0;
+}
+
+static int process_unix_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_path(argv, i, argc, &config->unix_path);
+}
+
+static int process_snapshot_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_path(argv, i, argc, &config->snapshot_path);
+}
+
+static int process_snapshot_every_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_tick_interval(argv, i, argc, &config->snapshot_every);
+}
+
+static int process_restore_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_path(argv, i, argc, &config->restore_path);
+}
+
+static int process_journal_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_path(argv, i, argc, &config->journal_path);
+}
+
+static int process_keyframe_every_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_tick_interval(argv, i, argc, &config->keyframe_every);
+}
+
+static int process_admin_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    return parse_path(argv, i, argc, &config->admin_path);
+}
+
+static int process_seed_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    char *end;
+
+    if (*i + 1 >= argc)
+        return -1;
+    config->seed = strtoull(argv[*i + 1], &end, 10);
+    if (*end != '\0' || end == argv[*i + 1] || argv[*i + 1][0] == '-')
+        return -1;
+    config->has_seed = true;
+    (*i)++;
+    return 0;
+}
+
+static int process_turbo_arg(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    (void)argv;
+    (void)i;
+    (void)argc;
+    config->turbo = true;
+    return 0;
+}
+
+static const option_entry_t option_table[] = {
+    {"--log-level", process_log_level_arg},
+    {"--io-threads", process_io_threads_arg},
+    {"--tick-threads", process_tick_threads_arg},
+    {"--games", process_games_arg},
+    {"--unix", process_unix_arg},
+    {"--snapshot", process_snapshot_arg},
+    {"--snapshot-every", process_snapshot_every_arg},
+    {"--restore", process_restore_arg},
+    {"--journal", process_journal_arg},
+    {"--keyframe-every", process_keyframe_every_arg},
+    {"--admin", process_admin_arg},
+    {"--seed", process_seed_arg},
+    {"--turbo", process_turbo_arg},
+    {NULL, NULL}
+};
+
+int process_option_argument(const char **argv, int *i, int argc,
+    server_config_t *config)
+{
+    for (size_t j = 0; option_table[j].name != NULL; ++j) {
+        if (strcmp(argv[*i], option_table[j].name) == 0)
+            return option_table[j].handler(argv, i, argc, config);
+    }
+    return -1;
+}
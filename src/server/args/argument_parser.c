@@ -10,14 +10,15 @@
 #include <time.h>
 
 #include "server/server.h"
+#include "server/journal.h"
 
 static int validate_config(const server_config_t *config)
 {
     if (config->port == 0)
         return -1;
-    if (config->width == 0)
+    if (config->width < MIN_MAP_SIZE || config->width > MAX_MAP_SIZE)
         return -1;
-    if (config->height == 0)
+    if (config->height < MIN_MAP_SIZE || config->height > MAX_MAP_SIZE)
         return -1;
     if (config->max_clients_per_team == 0)
         return -1;
@@ -27,6 +28,10 @@ static int validate_config(const server_config_t *config)
         return -1;
     if (config->port < 1024 || config->port > 65535)
         return -1;
+    if (config->games > 1 && (config->snapshot_path ||
+        config->restore_path || config->journal_path ||
+        config->admin_path))
+        return -1;
     return 0;
 }
 
@@ -34,9 +39,13 @@ int parse_arguments(int argc, const char **argv, server_config_t *config)
 {
     memset(config, 0, sizeof(server_config_t));
     config->refill_tiles = true;
+    config->log_level = LOG_LEVEL_INFO;
+    config->keyframe_every = JOURNAL_KEYFRAME_EVERY;
     for (int i = 1; i < argc; i++) {
         if (process_argument(argv, &i, argc, config) == -1)
             return -1;
     }
+    if (!config->has_seed)
+        config->seed = (uint64_t)time(NULL);
     return validate_config(config);
 }
@@ -8,8 +8,10 @@
 #include <stdio.h>
 
 #include "server/broadcast.h"
+#include "server/journal.h"
 #include "server/server_updates.h"
 #include "server/payloads.h"
+#include "server/map.h"
 
 void broadcast_string_message_to_guis(server_t *server, const char *message)
 {
@@ -18,7 +20,7 @@ void broadcast_string_message_to_guis(server_t *server, const char *message)
     if (!server || !message)
         return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        client = &server->clients[i];
+        client = server->clients[i];
         if (client->type == CLIENT_TYPE_GRAPHIC) {
             send_response(client, message);
         }
@@ -34,7 +36,7 @@ void broadcast_message_to_guis(server_t *server, player_t *player,
     if (!server || !player || !function)
         return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        client = &server->clients[i];
+        client = server->clients[i];
         if (client->type == CLIENT_TYPE_GRAPHIC) {
             send_response(client, payload);
         }
@@ -50,7 +52,7 @@ void broadcast_tile_to_guis(server_t *server, int x, int y)
     if (!server || !payload)
         return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        client = &server->clients[i];
+        client = server->clients[i];
         if (client->type == CLIENT_TYPE_GRAPHIC) {
             send_response(client, payload);
         }
@@ -67,10 +69,39 @@ void broadcast_player_resource_update(server_t *server, player_t *player,
     if (!server || !payload)
         return;
     for (size_t i = 0; i < server->client_count; ++i) {
-        client = &server->clients[i];
+        client = server->clients[i];
         if (client->type == CLIENT_TYPE_GRAPHIC) {
             send_response(client, payload);
         }
     }
     free(payload);
 }
+
+static bool has_gui(const server_t *server)
+{
+    for (size_t i = 0; i < server->client_count; ++i) {
+        if (server->clients[i]->type == CLIENT_TYPE_GRAPHIC)
+            return true;
+    }
+    return false;
+}
+
+// End of tick: one bct per tile touched, however many times it changed.
+// Nothing is formatted without a GUI, the first respawn of a large map
+// touches millions of tiles before anyone can watch. The journal still
+// records every one.
+void broadcast_dirty_tiles(server_t *server)
+{
+    map_t *map = server->game->map;
+    bool send = has_gui(server);
+    uint32_t i;
+
+    for (size_t n = 0; n < map->dirty_count; ++n) {
+        i = map->dirty_tiles[n];
+        map->dirty_bits[i / 64] &= ~(1ULL << (i % 64));
+        journal_tile(server, i);
+        if (send)
+            broadcast_tile_to_guis(server, tile_x(map, i), tile_y(map, i));
+    }
+    map_reset_dirty(map);
+}
@@ -10,51 +10,55 @@
 #include <errno.h>
 
 #include "server/server.h"
+#include "client_management_helper.h"
 
-static int expand_client_buffer(client_t *client, ssize_t received)
+// The buffer only ever holds one partial line between two receives, so
+// running out of room means the line is longer than MAX_LINE_LENGTH
+static int reserve_receive_space(client_t *client)
 {
-    if (client->buffer_pos + received >= client->buffer_size) {
-        client->buffer_size *= 2;
-        client->buffer = realloc(client->buffer, client->buffer_size);
-        if (!client->buffer)
-            return -1;
-    }
-    return 0;
-}
-
-static ssize_t receive_raw_data(client_t *client, char *buffer)
-{
-    ssize_t received = recv(client->fd, buffer, 1023, MSG_DONTWAIT);
-
-    if (received == -1) {
-        if (errno == EAGAIN || errno == EWOULDBLOCK)
-            return 0;
+    size_t size = client->buffer_size * 2;
+    char *buffer;
+
+    if (client->buffer_pos < client->buffer_size)
+        return 0;
+    if (client->buffer_size >= MAX_LINE_LENGTH) {
+        LOG_WARN("[SERVER] Client %d exceeded the %d byte line limit",
+            client->fd, MAX_LINE_LENGTH);
         return -1;
     }
-    if (received == 0)
+    if (size > MAX_LINE_LENGTH)
+        size = MAX_LINE_LENGTH;
+    buffer = realloc(client->buffer, size);
+    if (!buffer)
         return -1;
-    buffer[received] = '\0';
-    return received;
+    client->buffer = buffer;
+    client->buffer_size = size;
+    return 0;
 }
 
 static int receive_client_data(client_t *client)
 {
-    char buffer[1024];
-    ssize_t received = receive_raw_data(client, buffer);
+    ssize_t received;
 
-    if (received <= 0)
-        return received;
-    if (expand_client_buffer(client, received) == -1)
+    if (initialize_client_buffer(client) == -1 ||
+        reserve_receive_space(client) == -1)
+        return -1;
+    received = recv(client->fd, client->buffer + client->buffer_pos,
+        client->buffer_size - client->buffer_pos, MSG_DONTWAIT);
+    if (received == -1)
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    if (received == 0)
         return -1;
-    memcpy(client->buffer + client->buffer_pos, buffer, received);
     client->buffer_pos += received;
     return 1;
 }
 
-static void process_command(server_t *server, client_t *client,
+void client_process_command(server_t *server, client_t *client,
     const char *command)
 {
-    printf("Processing command: %s\n", command);
+    LOG_DEBUG("Processing command: %s", command);
+    client->traffic.messages_in++;
+    client->traffic.bytes_in += strlen(command) + 1;
     if (!client->is_authenticated) {
         client_authenticate(server, client, command);
         return;
@@ -66,32 +70,32 @@ static void process_command(server_t *server, client_t *client,
     }
 }
 
-static void process_message_line(server_t *server, client_t *client,
-    char *newline)
-{
-    size_t msg_len = newline - client->buffer;
-
-    *newline = '\0';
-    process_command(server, client, client->buffer);
-    memmove(client->buffer, newline + 1, client->buffer_pos - msg_len - 1);
-    client->buffer_pos -= msg_len + 1;
-}
-
 static void handle_receive_error(server_t *server, client_t *client)
 {
-    size_t client_index = client - server->clients;
-
-    client_remove(server, client_index);
+    client_remove(server, client);
 }
 
+// Lines are handled in place behind a read cursor; the trailing partial
+// line is moved to the front once per receive
 static void process_received_messages(server_t *server, client_t *client)
 {
+    size_t start = 0;
     char *newline = memchr(client->buffer, '\n', client->buffer_pos);
 
     while (newline) {
-        process_message_line(server, client, newline);
-        newline = memchr(client->buffer, '\n', client->buffer_pos);
+        *newline = '\0';
+        client_process_command(server, client, client->buffer + start);
+        if (client->fd == -1)
+            return;
+        start = newline - client->buffer + 1;
+        newline = memchr(client->buffer + start, '\n',
+            client->buffer_pos - start);
     }
+    if (start == 0)
+        return;
+    memmove(client->buffer, client->buffer + start,
+        client->buffer_pos - start);
+    client->buffer_pos -= start;
 }
 
 void client_handle_message(server_t *server, client_t *client)
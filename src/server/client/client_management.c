@@ -13,71 +13,81 @@
 #include "server/server.h"
 #include "server/time.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
+#include "server/metrics.h"
 #include "server/protocol_graphic.h"
 #include "server/payloads.h"
 #include "server/command_handler.h"
 #include "server/egg.h"
+#include "server/team.h"
 #include "server/dynamic_array.h"
-#include "client_management_helper.h"
+#include "server/client_slab.h"
+#include "server/io_pool.h"
+#include "server/snapshot.h"
 #include "client_management_extra.h"
 
-static int setup_client_connection(client_t *client,
-    int client_fd)
+static void update_poll_fds(server_t *server, client_t *client)
 {
-    client->fd = client_fd;
-    client->type = CLIENT_TYPE_UNKNOWN;
-    client->is_authenticated = false;
-    client->team_name = NULL;
-    if (initialize_client_buffer(client) == -1) {
-        close(client_fd);
-        return -1;
-    }
-    client->action_queue_head = NULL;
-    client->action_queue_tail = NULL;
-    client->action_queue_count = 0;
-    return 0;
+    struct pollfd *pfd =
+        &server->poll_fds[client->poll_index + server->listener_count];
+
+    pfd->fd = client->fd;
+    pfd->events = POLLIN;
+    pfd->revents = 0;
 }
 
-static void update_poll_fds(server_t *server, int client_fd)
+// Clients handed over by a host were already welcomed by its lobby
+client_t *client_attach(server_t *server, int client_fd)
 {
-    server->poll_fds[server->poll_count].fd = client_fd;
-    server->poll_fds[server->poll_count].events = POLLIN;
-    server->client_count++;
-    server->poll_count++;
+    client_t *client;
+
+    if (!server)
+        return NULL;
+    client = client_slot_acquire(server);
+    if (!client)
+        return NULL;
+    client->fd = client_fd;
+    client->type = CLIENT_TYPE_UNKNOWN;
+    if (server->io)
+        io_pool_attach(server, client);
+    else
+        update_poll_fds(server, client);
+    return client;
 }
 
 int client_add(server_t *server, int client_fd)
 {
-    client_t *client;
-    ssize_t sent;
+    client_t *client = client_attach(server, client_fd);
 
-    if (!server || server->client_count >= server->client_capacity)
+    if (!client)
         return -1;
-    client = &server->clients[server->client_count];
-    if (setup_client_connection(client, client_fd) == -1)
-        return -1;
-    update_poll_fds(server, client_fd);
-    sent = send(client_fd, "WELCOME\n", 8, 0);
-    (void)sent;
+    send_response(client, "WELCOME\n");
     return 0;
 }
 
-static void cleanup_client_resources(client_t *client)
+// With I/O threads the socket is closed by its thread once flushed
+static void close_client_socket(client_t *client)
+{
+    if (client->io)
+        io_pool_detach(client);
+    else if (client->fd != -1)
+        close(client->fd);
+}
+
+static void cleanup_client_resources(server_t *server, client_t *client)
 {
     action_t *action;
     action_t *next;
 
-    if (client->fd != -1)
-        close(client->fd);
-    if (client->buffer)
-        free(client->buffer);
-    if (client->team_name)
-        free(client->team_name);
+    close_client_socket(client);
+    free(client->buffer);
+    client->buffer = NULL;
+    free(client->team_name);
+    client->team_name = NULL;
     action = client->action_queue_head;
     while (action) {
         next = action->next;
-        free(action->command);
-        free(action);
+        action_release(server, action);
         action = next;
     }
     client->action_queue_head = NULL;
@@ -85,25 +95,16 @@ static void cleanup_client_resources(client_t *client)
     client->action_queue_count = 0;
 }
 
-static void shift_clients_array(server_t *server, size_t index)
-{
-    for (size_t i = index; i < server->client_count - 1; ++i)
-        server->clients[i] = server->clients[i + 1];
-}
-
-static void update_poll_fds_after_removal(server_t *server)
-{
-    for (size_t i = 1; i <= server->client_count; ++i) {
-        server->poll_fds[i].fd = server->clients[i - 1].fd;
-        server->poll_fds[i].events = POLLIN;
-    }
-    server->poll_count = server->client_count + 1;
-}
-
 static void remove_player_from_game(server_t *server, player_t *player)
 {
     if (!server || !server->game || !player)
         return;
+    player_remove_from_tile(server->game->map, player);
+    if (player->is_alive)
+        team_track_player(server->game, player, -1);
+    team_count_member(server->game, player, -1);
+    if ((size_t)player->id < server->game->id_capacity)
+        server->game->players_by_id[player->id] = NULL;
     for (size_t j = 0; j < server->game->player_count; ++j) {
         if (server->game->players[j] != player) {
             continue;
@@ -116,21 +117,22 @@ static void remove_player_from_game(server_t *server, player_t *player)
     }
 }
 
-void client_remove(server_t *server, size_t index)
+void client_remove(server_t *server, client_t *client)
 {
     player_t *player;
 
-    if (!server || index >= server->client_count)
+    if (!server || !client || client->fd == -1)
         return;
-    player = server->clients[index].player;
+    player = client->player;
     if (player) {
         broadcast_message_to_guis(server, player, gui_payload_pdi);
+        journal_player(server, JOURNAL_PDI, player);
         remove_player_from_game(server, player);
     }
-    cleanup_client_resources(&server->clients[index]);
-    shift_clients_array(server, index);
-    server->client_count--;
-    update_poll_fds_after_removal(server);
+    scheduler_remove(&server->scheduler, client);
+    metrics_retire(server, client);
+    cleanup_client_resources(server, client);
+    client_slot_release(server, client);
 }
 
 client_t *client_find_by_fd(server_t *server, int fd)
@@ -138,8 +140,8 @@ client_t *client_find_by_fd(server_t *server, int fd)
     if (!server)
         return NULL;
     for (size_t i = 0; i < server->client_count; ++i) {
-        if (server->clients[i].fd == fd)
-            return &server->clients[i];
+        if (server->clients[i]->fd == fd)
+            return server->clients[i];
     }
     return NULL;
 }
@@ -150,7 +152,7 @@ void client_authenticate(server_t *server, client_t *client,
     if (!server || !client || !message)
         return;
     if (strcmp(message, "GRAPHIC") != 0) {
-        printf("AI client authenticated with team: %s\n", message);
+        LOG_INFO("AI client authenticated with team: %s", message);
         client_validate(server, client, message);
         return;
     }
@@ -159,9 +161,9 @@ void client_authenticate(server_t *server, client_t *client,
     protocol_send_map_size(server, client);
     send_all_tiles(server, client);
     for (size_t i = 0; i < server->client_count; ++i) {
-        if (server->clients[i].type == CLIENT_TYPE_AI &&
-            server->clients[i].player != NULL) {
-            protocol_send_player_info(client, server->clients[i].player);
+        if (server->clients[i]->type == CLIENT_TYPE_AI &&
+            server->clients[i]->player != NULL) {
+            protocol_send_player_info(client, server->clients[i]->player);
         }
     }
 }
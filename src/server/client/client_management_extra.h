@@ -8,74 +8,62 @@
 #ifndef CLIENT_MANAGEMENT_EXTRA_H
     #define CLIENT_MANAGEMENT_EXTRA_H
 
-// add some egg stuff here
-static inline int count_players_in_team(server_t *server,
-    const char *team_name)
+// Unknown team names still authenticate, the caller answers ko
+static inline bool can_client_connect(server_t *server, client_t *client,
+    int team_id)
 {
-    int count = 0;
-    player_t *p;
-
-    for (size_t i = 0; i < server->game->player_count; ++i) {
-        p = server->game->players[i];
-        if (p && p->team_name && strcmp(p->team_name, team_name) == 0)
-            count++;
-    }
-    return count;
+    if (!server || !client || !client->team_name)
+        return false;
+    client->is_authenticated = true;
+    return team_id >= 0 && server->game->team_members[team_id] <
+        server->config.max_clients_per_team;
 }
 
-static inline bool can_client_connect(server_t *server, client_t *client)
+// The id comes from add_player_to_game, so it is set before any broadcast
+static inline bool spawn_player(server_t *server, client_t *client,
+    const int pos[2], int team_id)
 {
-    int available;
-    int current;
-    bool team_found = false;
-
-    if (!server || !client || !client->team_name ||
-        server->game->player_count >= server->game->player_capacity)
+    client->player = player_create(client, pos[0], pos[1],
+        server->config.team_names[team_id]);
+    if (!client->player)
+        return false;
+    client->player->team_id = team_id;
+    if (add_player_to_game(server->game, client->player) == -1) {
+        player_destroy(client->player);
+        client->player = NULL;
         return false;
-    for (size_t i = 0; i < server->config.team_count; ++i) {
-        if (strcmp(client->team_name, server->config.team_names[i]) == 0) {
-            current = count_players_in_team(server, client->team_name);
-            available = (int)server->config.max_clients_per_team - current;
-            team_found = available > 0;
-            break;
-        }
     }
-    client->is_authenticated = true;
-    return team_found;
+    player_set_position(server, client->player, pos[0], pos[1]);
+    broadcast_message_to_guis(server, client->player, gui_payload_pnw);
+    journal_player(server, JOURNAL_PNW, client->player);
+    return true;
 }
 
 static inline bool try_regular_connect(server_t *server, client_t *client,
-    const char *message)
+    int team_id)
 {
-    int p[2] = {rand() % server->config.width, rand() % server->config.height};
+    int p[2];
 
     if (!server || !client || !client->team_name ||
-        server->game->player_count >= server->game->player_capacity ||
-        !can_client_connect(server, client))
+        !can_client_connect(server, client, team_id))
         return false;
+    p[0] = rng_below(&server->rng, server->config.width);
+    p[1] = rng_below(&server->rng, server->config.height);
     client->type = CLIENT_TYPE_AI;
-    client->player = player_create(client, p[0], p[1], message);
-    if (client->player) {
-        player_set_position(server, client->player, p[0], p[1]);
-        add_player_to_game(server->game, client->player);
-        broadcast_message_to_guis(server, client->player, gui_payload_pnw);
-    }
-    return true;
+    return spawn_player(server, client, p, team_id);
 }
 
 static inline bool hatch_from_egg(server_t *server, client_t *client,
     egg_t *egg)
 {
-    if (!server || !client || !egg || egg->hatched || egg->connected)
+    if (!server || !client || !egg || !egg->hatched || egg->connected)
         return false;
-    client->player = player_create(client, egg->x, egg->y, egg->team_name);
-    if (!client->player)
+    if (!spawn_player(server, client, (int [2]){egg->x, egg->y},
+        egg->team_id))
         return false;
-    player_set_position(server, client->player, egg->x, egg->y);
-    add_player_to_game(server->game, client->player);
-    broadcast_message_to_guis(server, client->player, gui_payload_pnw);
     egg->connected = true;
     broadcast_egg_hatched(server, egg->id);
+    journal_egg(server, JOURNAL_EBO, egg->id, NULL);
     egg_manager_remove_egg(server, egg);
     egg_die(server, egg);
     return true;
@@ -84,18 +72,20 @@ static inline bool hatch_from_egg(server_t *server, client_t *client,
 static inline void client_validate(server_t *server, client_t *client,
     const char *message)
 {
+    int team_id = team_find_id(&server->config, message);
     char res[1024];
 
     client->team_name = strndup(message, strlen(message));
     client->type = CLIENT_TYPE_AI;
-    if (!try_regular_connect(server, client, message) &&
+    if (!snapshot_resume(server, client, team_id) &&
+        !try_regular_connect(server, client, team_id) &&
         !hatch_from_egg(server, client,
-            egg_manager_find_available_egg(server, message)))
+            egg_manager_find_available_egg(server, team_id)))
         return send_response(client, "ko\n");
     snprintf(res, sizeof res, "%ld\n", 1 +
         (server->config.max_clients_per_team -
-        count_players_in_team(server, client->team_name)) +
-        egg_manager_count_eggs(server, client->team_name));
+        server->game->team_members[team_id]) +
+        egg_manager_count_eggs(server, team_id));
     send_response(client, res);
     snprintf(res, sizeof(res), "%ld %ld\n", server->config.width,
         server->config.height);
@@ -8,8 +8,11 @@
 #ifndef CLIENT_MANAGEMENT_HELPER_H
     #define CLIENT_MANAGEMENT_HELPER_H
 
+// Idle clients hold no receive buffer until their first bytes arrive
 static inline int initialize_client_buffer(client_t *client)
 {
+    if (client->buffer)
+        return 0;
     client->buffer_size = BUFFER_SIZE;
     client->buffer = malloc(client->buffer_size);
     if (!client->buffer)
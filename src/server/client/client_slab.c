@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/client/client_slab.c
+** File description:
+** Slab storage for client slots
+*/
+
+#include <string.h>
+
+#include "server/client_slab.h"
+#include "server/dynamic_array.h"
+
+static void free_slab_slots(server_t *server, client_t *slab, size_t base)
+{
+    for (size_t i = CLIENT_SLAB_SIZE; i > 0; --i) {
+        slab[i - 1].fd = -1;
+        slab[i - 1].slot = base + i - 1;
+        DA_PUSH(server->free_slots, slab[i - 1].slot);
+    }
+}
+
+static int grow_slabs(server_t *server)
+{
+    client_t **slabs;
+    client_t *slab;
+
+    slabs = realloc(server->client_slabs,
+        (server->slab_count + 1) * sizeof(*slabs));
+    if (!slabs)
+        return -1;
+    server->client_slabs = slabs;
+    slab = calloc(CLIENT_SLAB_SIZE, sizeof(*slab));
+    if (!slab)
+        return -1;
+    slabs[server->slab_count] = slab;
+    server->slab_count++;
+    free_slab_slots(server, slab, server->client_capacity);
+    server->client_capacity += CLIENT_SLAB_SIZE;
+    return 0;
+}
+
+static int reserve_active(server_t *server)
+{
+    size_t capacity = server->active_capacity;
+    client_t **clients;
+    struct pollfd *fds;
+
+    if (server->client_count < capacity)
+        return 0;
+    capacity = capacity ? capacity * 2 : CLIENT_SLAB_SIZE;
+    clients = realloc(server->clients, capacity * sizeof(*clients));
+    if (!clients)
+        return -1;
+    server->clients = clients;
+    fds = realloc(server->poll_fds,
+        (capacity + server->listener_count) * sizeof(*fds));
+    if (!fds)
+        return -1;
+    server->poll_fds = fds;
+    server->active_capacity = capacity;
+    return 0;
+}
+
+// The generation survives the reset so stale I/O messages can be told apart
+static void reset_slot(client_t *client, size_t slot)
+{
+    uint32_t generation = client->generation + 1;
+
+    memset(client, 0, sizeof(*client));
+    client->fd = -1;
+    client->slot = slot;
+    client->generation = generation;
+}
+
+static void append_active(server_t *server, client_t *client)
+{
+    client->poll_index = server->client_count;
+    server->clients[server->client_count] = client;
+    server->client_count++;
+    server->poll_count = server->client_count + server->listener_count;
+}
+
+client_t *client_slot_acquire(server_t *server)
+{
+    client_t *client;
+    size_t slot;
+
+    if (server->client_count >= server->max_clients ||
+        reserve_active(server) == -1)
+        return NULL;
+    if (DA_LEN(server->free_slots) == 0 && grow_slabs(server) == -1)
+        return NULL;
+    slot = DA_LAST(server->free_slots);
+    DA_POP(server->free_slots);
+    client = client_from_slot(server, slot);
+    if (!client)
+        return NULL;
+    reset_slot(client, slot);
+    append_active(server, client);
+    return client;
+}
+
+void client_slot_release(server_t *server, client_t *client)
+{
+    size_t index = client->poll_index;
+    size_t last = server->client_count - 1;
+
+    server->clients[index] = server->clients[last];
+    server->clients[index]->poll_index = index;
+    server->poll_fds[index + server->listener_count] =
+        server->poll_fds[last + server->listener_count];
+    server->client_count--;
+    server->poll_count = server->client_count + server->listener_count;
+    client->fd = -1;
+    DA_PUSH(server->free_slots, client->slot);
+}
+
+client_t *client_from_slot(const server_t *server, size_t slot)
+{
+    if (slot >= server->client_capacity)
+        return NULL;
+    return &server->client_slabs[slot / CLIENT_SLAB_SIZE]
+        [slot % CLIENT_SLAB_SIZE];
+}
+
+void client_storage_destroy(server_t *server)
+{
+    for (size_t i = 0; i < server->slab_count; ++i)
+        free(server->client_slabs[i]);
+    free(server->client_slabs);
+    server->client_slabs = NULL;
+    server->slab_count = 0;
+    server->client_capacity = 0;
+    free(server->clients);
+    server->clients = NULL;
+    server->client_count = 0;
+    if (server->free_slots) {
+        da_destroy(server->free_slots);
+        server->free_slots = NULL;
+    }
+}
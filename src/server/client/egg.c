@@ -8,8 +8,8 @@
 #include "server/egg.h"
 #include "server/server.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
 #include "server/egg_manager.h"
-#include "server/dynamic_array.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -18,35 +18,43 @@ void egg_die(server_t *server, egg_t *egg)
     if (!server || !egg)
         return;
     broadcast_egg_died(server, egg->id);
-    free(egg->team_name);
-    free(egg);
+    journal_egg(server, JOURNAL_EDI, egg->id, NULL);
+    object_pool_free(&server->egg_pool, egg);
 }
 
+// Pushed at the head, so connections take the most recently hatched egg
 void hatch_egg(server_t *server, egg_t *egg)
 {
+    team_eggs_t *team;
+
     if (!server || !egg || egg->hatched)
         return;
+    team = egg_manager_team(server, egg->team_id);
+    if (!team)
+        return;
+    egg_list_unlink(&team->unhatched, egg);
     egg->hatched = true;
+    egg_list_push(&team->hatched, egg);
+    team->hatched_count++;
     broadcast_egg_hatched(server, egg->id);
+    journal_egg(server, JOURNAL_EBO, egg->id, NULL);
 }
 
 egg_t *create_egg(server_t *server, player_t *parent)
 {
-    static int egg_id_counter = 0;
     egg_t *egg = NULL;
 
     if (!server || !parent)
         return NULL;
-    egg = malloc(sizeof(egg_t));
+    egg = object_pool_alloc(&server->egg_pool);
     if (!egg)
         return NULL;
-    egg->id = egg_id_counter;
-    ++egg_id_counter;
-    egg->team_name = strdup(parent->team_name);
+    egg->id = server->next_egg_id;
+    server->next_egg_id++;
+    egg->team_id = parent->team_id;
     egg->x = parent->x;
     egg->y = parent->y;
-    egg->hatched = false;
-    egg->connected = false;
     broadcast_egg_laid(server, egg->id, parent);
+    journal_egg(server, JOURNAL_ENW, egg->id, parent);
     return egg;
 }
@@ -17,7 +17,7 @@ static void send_map_size(server_t *server, client_t *client)
 
     snprintf(response, sizeof(response), "msz %zu %zu\n",
         server->config.width, server->config.height);
-    send(client->fd, response, strlen(response), 0);
+    send_response(client, response);
 }
 
 static void send_tile_content(server_t *server, client_t *client, int x, int y)
@@ -26,7 +26,7 @@ static void send_tile_content(server_t *server, client_t *client, int x, int y)
 
     (void)server;
     snprintf(response, sizeof(response), "bct %d %d 2 1 0 3 1 1 1\n", x, y);
-    send(client->fd, response, strlen(response), 0);
+    send_response(client, response);
 }
 
 void send_all_tiles(server_t *server, client_t *client)
@@ -45,7 +45,7 @@ static void send_team_names(server_t *server, client_t *client)
     for (size_t i = 0; i < server->config.team_count; i++) {
         snprintf(response, sizeof(response), "tna %s\n",
             server->config.team_names[i]);
-        send(client->fd, response, strlen(response), 0);
+        send_response(client, response);
     }
 }
 
@@ -76,7 +76,7 @@ static void handle_team_names_command(server_t *server, client_t *client)
 
 static void handle_unknown_command(client_t *client)
 {
-    send(client->fd, "suc\n", 4, 0);
+    send_response(client, "suc\n");
 }
 
 void command_handle_graphic(server_t *server, client_t *client,
@@ -12,70 +12,67 @@
 #include "server/server.h"
 #include "server/egg.h"
 #include "server/broadcast.h"
-#include "server/dynamic_array.h"
+
+int egg_manager_init(server_t *server)
+{
+    object_pool_init(&server->egg_pool, "eggs", sizeof(egg_t),
+        EGG_POOL_SLAB);
+    server->team_eggs = calloc(server->config.team_count,
+        sizeof(*server->team_eggs));
+    if (!server->team_eggs)
+        return -1;
+    server->next_egg_id = 0;
+    return 0;
+}
+
+// Eggs live in the pool slabs, so they go with it
+void egg_manager_destroy(server_t *server)
+{
+    object_pool_log_stats(&server->egg_pool);
+    object_pool_destroy(&server->egg_pool);
+    free(server->team_eggs);
+    server->team_eggs = NULL;
+}
 
 egg_t *egg_manager_add_egg(server_t *server, player_t *parent)
 {
     egg_t *egg = NULL;
+    team_eggs_t *team;
 
     if (!server || !parent)
         return NULL;
+    team = egg_manager_team(server, parent->team_id);
+    if (!team)
+        return NULL;
     egg = create_egg(server, parent);
     if (!egg)
         return NULL;
-    server->eggs = da_push(server->eggs, &egg, sizeof(egg_t *));
+    egg_list_push(&team->unhatched, egg);
+    team->laid_count++;
     return egg;
 }
 
-size_t egg_manager_get_available_count(server_t *server, const char *team_name)
+egg_t *egg_manager_find_available_egg(server_t *server, int team_id)
 {
-    size_t available = 0;
-    egg_t **eggs = NULL;
+    team_eggs_t *team = server ? egg_manager_team(server, team_id) : NULL;
 
-    if (!server || !server->eggs || !team_name)
-        return 0;
-    eggs = server->eggs;
-    for (size_t i = 0; i < DA_LEN(eggs); i++) {
-        if (eggs[i] && eggs[i]->team_name &&
-            strcmp(eggs[i]->team_name, team_name) == 0 &&
-            eggs[i]->hatched && !eggs[i]->connected) {
-            available++;
-        }
-    }
-    return available;
-}
-
-egg_t *egg_manager_find_available_egg(server_t *server, const char *team_name)
-{
-    egg_t **eggs = NULL;
-
-    if (!server || !server->eggs || !team_name)
-        return NULL;
-    eggs = (egg_t **)server->eggs;
-    for (size_t i = 0; i < DA_LEN(eggs); i++) {
-        if (eggs[i] && eggs[i]->team_name &&
-            strcmp(eggs[i]->team_name, team_name) == 0 &&
-            eggs[i]->hatched && !eggs[i]->connected) {
-            return eggs[i];
-        }
-    }
-    return NULL;
+    return team ? team->hatched : NULL;
 }
 
 void egg_manager_remove_egg(server_t *server, egg_t *egg)
 {
-    egg_t **eggs = NULL;
-    size_t egg_count;
+    team_eggs_t *team;
 
-    if (!server || !server->eggs || !egg)
+    if (!server || !egg)
+        return;
+    team = egg_manager_team(server, egg->team_id);
+    if (!team)
         return;
-    eggs = server->eggs;
-    egg_count = DA_LEN(eggs);
-    for (size_t i = 0; i < egg_count; i++) {
-        if (eggs[i] && eggs[i]->id == egg->id) {
-            eggs[i] = eggs[egg_count - 1];
-            da_pop(server->eggs, sizeof(egg_t *));
-            return;
-        }
+    if (egg->hatched) {
+        egg_list_unlink(&team->hatched, egg);
+        team->hatched_count--;
+    } else {
+        egg_list_unlink(&team->unhatched, egg);
     }
+    team->laid_count--;
 }
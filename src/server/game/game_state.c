@@ -8,18 +8,21 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/time.h>
+#include <time.h>
 
 #include "server/resource.h"
 #include "server/server.h"
 #include "server/lifecycle.h"
+#include "server/vision.h"
+#include "server/team.h"
 
+// Monotonic: only paces ticks, so it must not jump with the system clock
 double get_current_time(void)
 {
-    struct timeval tv;
+    struct timespec ts;
 
-    gettimeofday(&tv, NULL);
-    return tv.tv_sec + tv.tv_usec / 1000000.0;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
 }
 
 static int initialize_players_array(game_state_t *game)
@@ -53,12 +56,14 @@ game_state_t *game_state_create(server_t *server,
         free(game);
         return NULL;
     }
-    if (initialize_players_array(game) == -1) {
+    if (initialize_players_array(game) == -1 ||
+        team_stats_init(game, config->team_count) == -1) {
+        free(game->players);
         map_destroy(game->map);
         free(game);
         return NULL;
     }
-    game->current_time = get_current_time();
+    vision_init();
     return game;
 }
 
@@ -71,6 +76,7 @@ static void cleanup_players(game_state_t *game)
     for (i = 0; i < game->player_count; i++)
         player_destroy(game->players[i]);
     free(game->players);
+    free(game->players_by_id);
 }
 
 void game_state_destroy(game_state_t *game)
@@ -80,6 +86,8 @@ void game_state_destroy(game_state_t *game)
     if (game->map)
         map_destroy(game->map);
     cleanup_players(game);
+    free(game->team_members);
+    free(game->team_levels);
     free(game);
 }
 
@@ -88,22 +96,16 @@ static void player_update(player_t *player, server_t *server)
 {
     if (!player || !player->is_alive)
         return;
-    player->last_food_inhalation += 1;
-    if (player->last_food_inhalation >= FOOD_INHALATION_TIME) {
-        player->resources[RESOURCE_FOOD]--;
-        player->last_food_inhalation = 0;
-        if (player->resources[RESOURCE_FOOD] <= 0)
-            player_die(player->client, server);
-    }
+    if (player_digest(player))
+        player_die(player->client, server);
 }
 
-void game_state_update(server_t *server, double delta_time)
+void game_state_update(server_t *server)
 {
     player_t *player;
 
     if (!server || !server->game)
         return;
-    server->game->current_time += delta_time;
     for (size_t i = 0; i < server->game->player_count; ++i) {
         player = server->game->players[i];
         if (player == NULL || !player->is_alive) {
@@ -113,12 +115,58 @@ void game_state_update(server_t *server, double delta_time)
     }
 }
 
-void add_player_to_game(game_state_t *game, player_t *player)
+static int grow_players_array(game_state_t *game)
 {
-    if (!game || !player)
-        return;
-    if (game->players != NULL) {
-        game->players[game->player_count] = player;
-        ++game->player_count;
-    }
+    size_t capacity = game->player_capacity * 2;
+    player_t **players = realloc(game->players, capacity * sizeof(*players));
+
+    if (!players)
+        return -1;
+    game->players = players;
+    game->player_capacity = capacity;
+    return 0;
+}
+
+// Ids are handed out in order and never reused, so they index a dense
+// table directly; a removed player leaves a NULL behind
+static int grow_id_table(game_state_t *game, size_t id)
+{
+    size_t capacity = game->id_capacity ? game->id_capacity * 2 : 1024;
+    player_t **table;
+
+    while (capacity <= id)
+        capacity *= 2;
+    table = realloc(game->players_by_id, capacity * sizeof(*table));
+    if (!table)
+        return -1;
+    memset(table + game->id_capacity, 0,
+        (capacity - game->id_capacity) * sizeof(*table));
+    game->players_by_id = table;
+    game->id_capacity = capacity;
+    return 0;
+}
+
+// A player resumed from a snapshot comes with the id it had
+int add_player_to_game(game_state_t *game, player_t *player)
+{
+    int id;
+
+    if (!game || !player || !game->players)
+        return -1;
+    id = player->id ? player->id : game->next_player_id;
+    if (game->player_count >= game->player_capacity &&
+        grow_players_array(game) == -1)
+        return -1;
+    if ((size_t)id >= game->id_capacity && grow_id_table(game, id) == -1)
+        return -1;
+    if (!player->id)
+        game->next_player_id++;
+    player->id = id;
+    game->players_by_id[player->id] = player;
+    game->players[game->player_count] = player;
+    ++game->player_count;
+    team_count_member(game, player, 1);
+    if (player->is_alive)
+        team_track_player(game, player, 1);
+    return 0;
 }
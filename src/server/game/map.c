@@ -7,86 +7,109 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 
 #include "server/server.h"
 #include "server/game.h"
+#include "server/map.h"
 
-static void tile_init(tile_t *tile)
+// The stacks are most of a large map's memory. On huge pages a fork copies
+// one page table entry per 2 MB instead of per 4 kB, which is what keeps
+// the snapshot and keyframe forks short.
+static tile_stack_t *allocate_stacks(size_t count)
 {
-    if (!tile)
-        return;
-    memset(tile, 0, sizeof(tile_t));
-    tile->player_capacity = 100;
-    tile->players = calloc(tile->player_capacity, sizeof(player_t *));
-}
+    size_t size = count * sizeof(tile_stack_t);
+    tile_stack_t *stacks;
 
-static void tile_cleanup(tile_t *tile)
-{
-    if (!tile)
-        return;
-    if (tile->players) {
-        free(tile->players);
-        tile->players = NULL;
-    }
+    if (size < MAP_HUGE_PAGE)
+        return calloc(count, sizeof(tile_stack_t));
+    size = (size + MAP_HUGE_PAGE - 1) & ~((size_t)MAP_HUGE_PAGE - 1);
+    stacks = aligned_alloc(MAP_HUGE_PAGE, size);
+    if (!stacks)
+        return NULL;
+    madvise(stacks, size, MADV_HUGEPAGE);
+    memset(stacks, 0, size);
+    return stacks;
 }
 
-static int initialize_tile_row(map_t *map, int y)
+// dirty_tiles starts small and grows, only the very first respawn of a
+// large map touches most tiles
+int allocate_map_tiles(map_t *map)
 {
-    int x;
-
-    map->tiles[y] = calloc(map->width, sizeof(tile_t));
-    if (!map->tiles[y])
+    map->tile_count = (size_t)map->width * map->height;
+    map->stacks = allocate_stacks(map->tile_count * RESOURCE_COUNT);
+    map->dirty_bits = calloc((map->tile_count + 63) / 64, sizeof(uint64_t));
+    map->dirty_capacity = map->tile_count < DIRTY_MIN_CAPACITY ?
+        map->tile_count : DIRTY_MIN_CAPACITY;
+    map->dirty_tiles = malloc(map->dirty_capacity * sizeof(uint32_t));
+    map->occupancy = malloc(OCCUPANCY_MIN_SLOTS * sizeof(occupancy_t));
+    if (!map->stacks || !map->dirty_bits || !map->dirty_tiles ||
+        !map->occupancy)
         return -1;
-    for (x = 0; x < map->width; x++) {
-        tile_init(&map->tiles[y][x]);
-        if (!map->tiles[y][x].players)
-            return -1;
-        map->tiles[y][x].x = x;
-        map->tiles[y][x].y = y;
-    }
+    map->occupancy_slots = OCCUPANCY_MIN_SLOTS;
+    for (size_t i = 0; i < OCCUPANCY_MIN_SLOTS; i++)
+        map->occupancy[i] = (occupancy_t){TILE_NONE, 0, NULL};
     return 0;
 }
 
-int allocate_map_tiles(map_t *map)
+void map_destroy(map_t *map)
 {
-    int y;
-
-    map->tiles = calloc(map->height, sizeof(tile_t *));
-    if (!map->tiles)
-        return -1;
-    for (y = 0; y < map->height; y++) {
-        if (initialize_tile_row(map, y) == -1)
-            return -1;
-    }
-    return 0;
+    if (!map)
+        return;
+    free(map->stacks);
+    free(map->occupancy);
+    free(map->dirty_bits);
+    free(map->dirty_tiles);
+    free(map);
 }
 
-static void cleanup_tile_row(map_t *map, int y)
+static int reserve_dirty(map_t *map)
 {
-    int x;
+    size_t capacity = map->dirty_capacity * 2;
+    uint32_t *tiles;
 
-    if (!map->tiles[y])
-        return;
-    for (x = 0; x < map->width; x++)
-        tile_cleanup(&map->tiles[y][x]);
-    free(map->tiles[y]);
+    if (map->dirty_count < map->dirty_capacity)
+        return 0;
+    if (capacity > map->tile_count)
+        capacity = map->tile_count;
+    tiles = realloc(map->dirty_tiles, capacity * sizeof(*tiles));
+    if (!tiles)
+        return -1;
+    map->dirty_tiles = tiles;
+    map->dirty_capacity = capacity;
+    return 0;
 }
 
-static void cleanup_all_tiles(map_t *map)
+// A tile that cannot be queued keeps its bit clear, so it is retried on
+// its next change rather than lost for good
+void map_mark_dirty(map_t *map, tile_id_t tile)
 {
-    int y;
+    uint64_t bit = 1ULL << (tile % 64);
 
-    if (!map->tiles)
+    if (map->dirty_bits[tile / 64] & bit)
+        return;
+    if (reserve_dirty(map) == -1) {
+        LOG_ERROR("[SERVER] Cannot queue the update of tile %u", tile);
         return;
-    for (y = 0; y < map->height; y++)
-        cleanup_tile_row(map, y);
-    free(map->tiles);
+    }
+    map->dirty_bits[tile / 64] |= bit;
+    map->dirty_tiles[map->dirty_count] = tile;
+    map->dirty_count++;
 }
 
-void map_destroy(map_t *map)
+// Once emptied, a queue a burst such as the first respawn left mostly
+// unused is halved, so it does not stay in every snapshot fork
+void map_reset_dirty(map_t *map)
 {
-    if (!map)
-        return;
-    cleanup_all_tiles(map);
-    free(map);
+    size_t capacity = map->dirty_capacity / 2;
+    uint32_t *tiles;
+
+    if (capacity >= DIRTY_MIN_CAPACITY && map->dirty_count <= capacity / 2) {
+        tiles = realloc(map->dirty_tiles, capacity * sizeof(*tiles));
+        if (tiles) {
+            map->dirty_tiles = tiles;
+            map->dirty_capacity = capacity;
+        }
+    }
+    map->dirty_count = 0;
 }
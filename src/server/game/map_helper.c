@@ -5,18 +5,14 @@
 ** map_helper
 */
 
-#include "server/server.h"
+#include <assert.h>
 
-tile_t *map_get_tile(const map_t *map, int x, int y)
-{
-    if (!map || x < 0 || y < 0 || x >= map->width || y >= map->height)
-        return NULL;
-    return &map->tiles[y][x];
-}
+#include "server/server.h"
+#include "server/map.h"
 
 map_t *map_create(int width, int height)
 {
-    map_t *map = malloc(sizeof(map_t));
+    map_t *map = calloc(1, sizeof(map_t));
 
     if (!map)
         return NULL;
@@ -28,3 +24,30 @@ map_t *map_create(int width, int height)
     }
     return map;
 }
+
+// Stacks saturate at TILE_STACK_MAX, totals follow what was really stored
+void map_add_resource(map_t *map, tile_id_t tile, int type, int amount)
+{
+    tile_stack_t *stack = &map->stacks[(size_t)type * map->tile_count + tile];
+    int value = *stack + amount;
+
+    if (value > TILE_STACK_MAX)
+        value = TILE_STACK_MAX;
+    if (value < 0)
+        value = 0;
+    map->totals[type] += value - *stack;
+    *stack = (tile_stack_t)value;
+}
+
+// Full scan, only called through MAP_CHECK_TOTALS in debug builds
+void map_check_totals(const map_t *map)
+{
+    int sum;
+
+    for (int type = 0; type < RESOURCE_COUNT; ++type) {
+        sum = 0;
+        for (size_t i = 0; i < map->tile_count; ++i)
+            sum += map_stack(map, i, type);
+        assert(sum == map->totals[type]);
+    }
+}
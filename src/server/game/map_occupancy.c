@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/game/map_occupancy.c
+** File description:
+** Open-addressed table of the occupied tiles
+*/
+
+#include <stdlib.h>
+
+#include "server/map.h"
+
+// Linear probing, kept at most half full so a miss (most Look cells) stops
+// on a free slot within a probe or two
+static size_t slot_of(const map_t *map, tile_id_t tile)
+{
+    uint32_t hash = tile * 0x9E3779B1u;
+
+    return (hash ^ (hash >> 15)) & (map->occupancy_slots - 1);
+}
+
+const occupancy_t *map_occupancy(const map_t *map, tile_id_t tile)
+{
+    size_t i = slot_of(map, tile);
+
+    while (map->occupancy[i].tile != TILE_NONE) {
+        if (map->occupancy[i].tile == tile)
+            return &map->occupancy[i];
+        i = (i + 1) & (map->occupancy_slots - 1);
+    }
+    return NULL;
+}
+
+static int grow_occupancy(map_t *map)
+{
+    occupancy_t *old = map->occupancy;
+    size_t old_slots = map->occupancy_slots;
+    occupancy_t *table = malloc(old_slots * 2 * sizeof(*table));
+    size_t i;
+
+    if (!table)
+        return -1;
+    for (i = 0; i < old_slots * 2; ++i)
+        table[i].tile = TILE_NONE;
+    map->occupancy = table;
+    map->occupancy_slots = old_slots * 2;
+    for (size_t j = 0; j < old_slots; ++j) {
+        if (old[j].tile == TILE_NONE)
+            continue;
+        for (i = slot_of(map, old[j].tile); table[i].tile != TILE_NONE;)
+            i = (i + 1) & (map->occupancy_slots - 1);
+        table[i] = old[j];
+    }
+    free(old);
+    return 0;
+}
+
+occupancy_t *map_occupy(map_t *map, tile_id_t tile)
+{
+    size_t i;
+
+    if ((map->occupied + 1) * 2 > map->occupancy_slots &&
+        grow_occupancy(map) == -1)
+        return NULL;
+    i = slot_of(map, tile);
+    while (map->occupancy[i].tile != TILE_NONE) {
+        if (map->occupancy[i].tile == tile)
+            return &map->occupancy[i];
+        i = (i + 1) & (map->occupancy_slots - 1);
+    }
+    map->occupancy[i] = (occupancy_t){tile, 0, NULL};
+    map->occupied++;
+    return &map->occupancy[i];
+}
+
+// Backward-shift deletion: later entries of the probe run move up so no
+// lookup ever stops early on the freed slot
+void map_vacate(map_t *map, occupancy_t *slot)
+{
+    size_t mask = map->occupancy_slots - 1;
+    size_t hole = slot - map->occupancy;
+    size_t i = (hole + 1) & mask;
+    size_t home;
+
+    while (map->occupancy[i].tile != TILE_NONE) {
+        home = slot_of(map, map->occupancy[i].tile);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            map->occupancy[hole] = map->occupancy[i];
+            hole = i;
+        }
+        i = (i + 1) & mask;
+    }
+    map->occupancy[hole].tile = TILE_NONE;
+    map->occupancy[hole].head = NULL;
+    map->occupied--;
+}
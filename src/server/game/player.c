@@ -9,7 +9,9 @@
 #include <string.h>
 
 #include "server/server.h"
+#include "server/map.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
 #include "server/payloads.h"
 #include "server/server_updates.h"
 
@@ -19,19 +21,19 @@ player_t *player_create(client_t *client, int x, int y, const char *team_name)
 
     if (!player)
         return NULL;
-    player->id = client->fd;
     player->x = x;
     player->y = y;
     player->orientation = 1;
     player->level = 1;
+    player->team_id = -1;
     player->client = client;
+    player->tile = TILE_NONE;
     player->team_name = strdup(team_name);
     if (!player->team_name) {
         free(player);
         return NULL;
     }
     player->resources[RESOURCE_FOOD] = 10;
-    player->last_action_time = get_current_time();
     player->is_alive = true;
     return player;
 }
@@ -45,61 +47,85 @@ void player_destroy(player_t *player)
     free(player);
 }
 
-static void shift_players_in_tile(tile_t *tile, size_t removed_index)
+void player_remove_from_tile(map_t *map, player_t *player)
 {
-    size_t j;
+    occupancy_t *slot;
 
-    for (j = removed_index; j < tile->player_count - 1; j++)
-        tile->players[j] = tile->players[j + 1];
+    if (!player || player->tile == TILE_NONE)
+        return;
+    slot = (occupancy_t *)map_occupancy(map, player->tile);
+    if (player->tile_prev)
+        player->tile_prev->tile_next = player->tile_next;
+    else
+        slot->head = player->tile_next;
+    if (player->tile_next)
+        player->tile_next->tile_prev = player->tile_prev;
+    slot->count--;
+    if (slot->count == 0)
+        map_vacate(map, slot);
+    player->tile = TILE_NONE;
+    player->tile_prev = NULL;
+    player->tile_next = NULL;
 }
 
-static void remove_player_from_tile(player_t *player, map_t *map)
+static void add_player_to_tile(player_t *player, map_t *map)
 {
-    tile_t *tile = map_get_tile(map, player->x, player->y);
-    size_t i;
+    tile_id_t tile = map_tile_at(map, player->x, player->y);
+    occupancy_t *slot = tile == TILE_NONE ? NULL : map_occupy(map, tile);
 
-    if (!tile)
+    if (!slot)
         return;
-    for (i = 0; i < tile->player_count; i++) {
-        if (tile->players[i] == player) {
-            shift_players_in_tile(tile, i);
-            tile->player_count--;
-            break;
-        }
-    }
+    player->tile = tile;
+    player->tile_prev = NULL;
+    player->tile_next = slot->head;
+    if (slot->head)
+        slot->head->tile_prev = player;
+    slot->head = player;
+    slot->count++;
 }
 
-static int add_player_to_tile(player_t *player, map_t *map)
+// Turning moves the player to the head of its own list like any other
+// move, without touching the occupancy table (see tick_pool.h)
+static void move_to_head(map_t *map, player_t *player)
 {
-    tile_t *tile = map_get_tile(map, player->x, player->y);
+    occupancy_t *slot = (occupancy_t *)map_occupancy(map, player->tile);
 
-    if (!tile)
-        return -1;
-    if (tile->player_count >= tile->player_capacity)
-        return -1;
-    tile->players[tile->player_count] = player;
-    tile->player_count++;
-    return 0;
+    if (slot->head == player)
+        return;
+    player->tile_prev->tile_next = player->tile_next;
+    if (player->tile_next)
+        player->tile_next->tile_prev = player->tile_prev;
+    player->tile_prev = NULL;
+    player->tile_next = slot->head;
+    slot->head->tile_prev = player;
+    slot->head = player;
 }
 
 void player_set_position(server_t *server, player_t *player, int x, int y)
 {
+    map_t *map;
+
     if (!player || !server)
         return;
-    remove_player_from_tile(player, server->game->map);
-    player->x = (x + server->game->map->width) % server->game->map->width;
-    player->y = (y + server->game->map->height) % server->game->map->height;
-    add_player_to_tile(player, server->game->map);
+    map = server->game->map;
+    x = (x + map->width) % map->width;
+    y = (y + map->height) % map->height;
+    if (player->tile != TILE_NONE && player->tile == map_tile_at(map, x, y)) {
+        move_to_head(map, player);
+    } else {
+        player_remove_from_tile(map, player);
+        player->x = x;
+        player->y = y;
+        add_player_to_tile(player, map);
+    }
     broadcast_message_to_guis(server, player, gui_payload_ppo);
+    journal_player(server, JOURNAL_PPO, player);
 }
 
 player_t *player_find_by_id(server_t *server, int id)
 {
-    if (!server || !server->game || !server->game->players)
+    if (!server || !server->game || id <= 0 ||
+        (size_t)id >= server->game->id_capacity)
         return NULL;
-    for (size_t i = 0; i < server->game->player_count; ++i) {
-        if (server->game->players[i]->id == id)
-            return server->game->players[i];
-    }
-    return NULL;
+    return server->game->players_by_id[id];
 }
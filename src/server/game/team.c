@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/game/team.c
+** File description:
+** Team ids and per-team level histograms
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/team.h"
+
+int team_find_id(const server_config_t *config, const char *name)
+{
+    if (!config || !name)
+        return -1;
+    for (size_t i = 0; i < config->team_count; ++i) {
+        if (strcmp(config->team_names[i], name) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+int team_stats_init(game_state_t *game, size_t team_count)
+{
+    game->team_count = team_count;
+    game->team_members = calloc(team_count, sizeof(*game->team_members));
+    game->team_levels = calloc(team_count * TEAM_LEVEL_SLOTS,
+        sizeof(*game->team_levels));
+    if (!game->team_members || !game->team_levels) {
+        free(game->team_members);
+        free(game->team_levels);
+        game->team_members = NULL;
+        game->team_levels = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+static size_t *level_slot(game_state_t *game, const player_t *player)
+{
+    int level = player->level;
+
+    if (player->team_id < 0 || (size_t)player->team_id >= game->team_count)
+        return NULL;
+    if (level > TEAM_MAX_LEVEL)
+        level = TEAM_MAX_LEVEL;
+    if (level < 0)
+        level = 0;
+    return &game->team_levels[player->team_id * TEAM_LEVEL_SLOTS + level];
+}
+
+void team_track_player(game_state_t *game, const player_t *player,
+    int delta)
+{
+    size_t *slot = game && player ? level_slot(game, player) : NULL;
+
+    if (slot)
+        *slot += delta;
+}
+
+void team_level_up(game_state_t *game, player_t *player)
+{
+    if (!game || !player)
+        return;
+    if (player->is_alive)
+        team_track_player(game, player, -1);
+    player->level++;
+    if (player->is_alive)
+        team_track_player(game, player, 1);
+}
@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/host.c
+** File description:
+** Listeners, lobby loop and game slots of a multi-game server
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host_internal.h"
+
+static void close_listeners(host_t *host)
+{
+    if (host->server_fd != -1)
+        close(host->server_fd);
+    unix_listener_destroy(host->unix_fd, host->config.unix_path);
+    signal_handler_cleanup(host->signal_fd);
+    free(host->fds);
+}
+
+// Signals are blocked before any game thread exists, only the host takes them
+static int open_listeners(host_t *host)
+{
+    host->unix_fd = -1;
+    host->signal_fd = signal_handler_init();
+    host->fds = calloc(2, sizeof(*host->fds));
+    host->server_fd = tcp_listener_create(host->config.port);
+    if (host->config.unix_path && host->server_fd != -1)
+        host->unix_fd = unix_listener_create(host->config.unix_path);
+    if (host->signal_fd == -1 || !host->fds || host->server_fd == -1 ||
+        (host->config.unix_path && host->unix_fd == -1)) {
+        close_listeners(host);
+        return -1;
+    }
+    return 0;
+}
+
+static void stop_games(host_t *host, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        host_game_stop(&host->games[i]);
+    free(host->games);
+}
+
+static int start_games(host_t *host)
+{
+    host->games = calloc(host->game_count, sizeof(host_game_t));
+    if (!host->games)
+        return -1;
+    for (size_t i = 0; i < host->game_count; ++i) {
+        host->games[i].index = i;
+        if (host_game_start(host, &host->games[i]) == -1) {
+            stop_games(host, i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void fill_poll_fds(host_t *host)
+{
+    host->fds[0] = (struct pollfd){host->server_fd, POLLIN, 0};
+    host->fds[1] = (struct pollfd){host->unix_fd, POLLIN, 0};
+    for (size_t i = 0; i < host->lobby_count; ++i)
+        host->fds[i + 2] = (struct pollfd){host->lobby[i].fd, POLLIN, 0};
+}
+
+// Lobby connections are served back to front, see lobby_read
+static void serve_ready(host_t *host)
+{
+    for (size_t i = host->lobby_count; i > 0; --i) {
+        if (host->fds[i + 1].revents)
+            lobby_read(host, i - 1);
+    }
+    lobby_expire(host);
+    for (size_t i = 0; i < 2; ++i) {
+        if (host->fds[i].revents & POLLIN)
+            lobby_accept(host, host->fds[i].fd);
+    }
+}
+
+static int host_poll(host_t *host)
+{
+    struct timespec timeout = {0, (long)(HOST_POLL_INTERVAL * 1e9)};
+    int ready;
+
+    fill_poll_fds(host);
+    ready = ppoll(host->fds, host->lobby_count + 2, &timeout, NULL);
+    if (ready == -1) {
+        if (errno == EINTR)
+            return 0;
+        LOG_ERROR("[HOST] Poll error: %s", strerror(errno));
+        return -1;
+    }
+    serve_ready(host);
+    return 0;
+}
+
+int host_run(const server_config_t *config)
+{
+    host_t host = {0};
+
+    host.config = *config;
+    host.game_count = config->games;
+    if (open_listeners(&host) == -1)
+        return -1;
+    if (start_games(&host) == -1) {
+        close_listeners(&host);
+        return -1;
+    }
+    lobby_init(&host);
+    LOG_INFO("[HOST] %zu games on port %zu, seeds from %llu", host.game_count,
+        config->port, (unsigned long long)config->seed);
+    while (!signal_handler_check(host.signal_fd) && host_poll(&host) == 0);
+    LOG_INFO("[HOST] Stopping %zu games", host.game_count);
+    lobby_destroy(&host);
+    stop_games(&host, host.game_count);
+    close_listeners(&host);
+    return 0;
+}
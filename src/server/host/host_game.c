@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/host_game.c
+** File description:
+** Game slots and the threads replaying games in them
+*/
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "host_internal.h"
+#include "server/thread.h"
+
+// Each pass plays one whole game, until it is won or the host stops
+static void *game_main(void *arg)
+{
+    host_game_t *game = arg;
+    server_t server;
+
+    while (!atomic_load(&game->stop)) {
+        if (server_create_hosted(&server, &game->config, game) == -1) {
+            LOG_ERROR("[HOST] Game %zu failed to start", game->index);
+            atomic_store(&game->stop, true);
+            break;
+        }
+        host_game_publish(&server);
+        server_run(&server);
+        server_destroy(&server);
+        game->config.seed += game->seed_step;
+        atomic_fetch_add(&game->played, 1);
+    }
+    return NULL;
+}
+
+// Until its game publishes, a slot offers what a fresh game does
+static int init_seats(host_t *host, host_game_t *game)
+{
+    game->seats = calloc(host->config.team_count, sizeof(size_t));
+    game->routed = calloc(host->config.team_count, sizeof(size_t));
+    if (!game->seats || !game->routed)
+        return -1;
+    for (size_t t = 0; t < host->config.team_count; ++t)
+        game->seats[t] = host->config.max_clients_per_team;
+    return 0;
+}
+
+// Slot k plays seeds seed + k, seed + k + N, ... so no two games share one
+static int init_game(host_t *host, host_game_t *game)
+{
+    game->config = host->config;
+    game->config.unix_path = NULL;
+    game->config.seed += game->index;
+    game->seed_step = host->game_count;
+    game->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (init_seats(host, game) == -1 || game->wake_fd == -1) {
+        free(game->seats);
+        free(game->routed);
+        if (game->wake_fd != -1)
+            close(game->wake_fd);
+        return -1;
+    }
+    pthread_mutex_init(&game->lock, NULL);
+    return 0;
+}
+
+int host_game_start(host_t *host, host_game_t *game)
+{
+    int ret;
+
+    if (init_game(host, game) == -1)
+        return -1;
+    ret = thread_spawn_unsignaled(&game->thread, game_main, game);
+    game->started = ret == 0;
+    if (ret != 0) {
+        host_game_stop(game);
+        return -1;
+    }
+    return 0;
+}
+
+// Clients still waiting in the inbox never reached their game
+void host_game_stop(host_game_t *game)
+{
+    uint64_t one = 1;
+
+    atomic_store(&game->stop, true);
+    if (game->started) {
+        if (write(game->wake_fd, &one, sizeof(one)) == -1)
+            LOG_DEBUG("[HOST] Game %zu already woken", game->index);
+        pthread_join(game->thread, NULL);
+        game->started = false;
+    }
+    for (size_t i = 0; i < game->inbox_count; ++i) {
+        close(game->inbox[i].fd);
+        free(game->inbox[i].line);
+    }
+    free(game->inbox);
+    free(game->seats);
+    free(game->routed);
+    close(game->wake_fd);
+    pthread_mutex_destroy(&game->lock);
+}
+
+bool host_game_stopping(const server_t *server)
+{
+    return atomic_load(&server->host->stop);
+}
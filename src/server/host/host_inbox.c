@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/host_inbox.c
+** File description:
+** Clients handed from the lobby to a game thread
+*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "server/egg.h"
+#include "host_internal.h"
+
+static int push_handoff(host_game_t *game, int fd, char *line)
+{
+    size_t capacity = game->inbox_capacity ? game->inbox_capacity * 2 : 16;
+    host_handoff_t *inbox = game->inbox;
+
+    if (game->inbox_count == game->inbox_capacity) {
+        inbox = realloc(game->inbox, capacity * sizeof(*inbox));
+        if (!inbox)
+            return -1;
+        game->inbox = inbox;
+        game->inbox_capacity = capacity;
+    }
+    game->inbox[game->inbox_count] = (host_handoff_t){fd, line};
+    game->inbox_count++;
+    return 0;
+}
+
+// The game gets the socket back in blocking mode, as accept() returns it
+int host_game_hand_off(host_game_t *game, int fd, const char *line)
+{
+    char *copy = line ? strdup(line) : NULL;
+    uint64_t one = 1;
+    int ret;
+
+    if (line && !copy)
+        return -1;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    pthread_mutex_lock(&game->lock);
+    ret = push_handoff(game, fd, copy);
+    pthread_mutex_unlock(&game->lock);
+    if (ret == -1) {
+        free(copy);
+        return -1;
+    }
+    if (write(game->wake_fd, &one, sizeof(one)) == -1)
+        LOG_DEBUG("[HOST] Game %zu already woken", game->index);
+    return 0;
+}
+
+static void adopt_one(server_t *server, const host_handoff_t *handoff)
+{
+    client_t *client = client_attach(server, handoff->fd);
+
+    if (!client) {
+        LOG_WARN("[HOST] Failed to add client");
+        close(handoff->fd);
+    } else if (handoff->line) {
+        client_process_command(server, client, handoff->line);
+    }
+    free(handoff->line);
+}
+
+// Swaps the inbox out so the lobby is never held up by a game's commands.
+// The seats of the batch stay taken until it is played and published.
+void host_game_adopt(server_t *server)
+{
+    host_game_t *game = server->host;
+    host_handoff_t *batch;
+    size_t count;
+    uint64_t value;
+
+    if (read(game->wake_fd, &value, sizeof(value)) == -1)
+        LOG_DEBUG("[HOST] Game %zu woken for nothing", game->index);
+    pthread_mutex_lock(&game->lock);
+    batch = game->inbox;
+    count = game->inbox_count;
+    game->inbox = NULL;
+    game->inbox_count = 0;
+    game->inbox_capacity = 0;
+    memset(game->routed, 0, server->config.team_count * sizeof(size_t));
+    pthread_mutex_unlock(&game->lock);
+    for (size_t i = 0; i < count; ++i)
+        adopt_one(server, &batch[i]);
+    free(batch);
+    host_game_publish(server);
+}
+
+// What Connect_nbr answers a member of the team
+static size_t free_seats(const server_t *server, int team)
+{
+    size_t members = server->game->team_members[team];
+    size_t max = server->config.max_clients_per_team;
+
+    return (members < max ? max - members : 0) +
+        egg_manager_get_available_count(server, team);
+}
+
+void host_game_publish(const server_t *server)
+{
+    host_game_t *game = server->host;
+    size_t seats;
+
+    if (!game)
+        return;
+    pthread_mutex_lock(&game->lock);
+    for (size_t t = 0; t < server->config.team_count; ++t) {
+        seats = free_seats(server, (int)t);
+        game->seats[t] = seats > game->routed[t] ? seats - game->routed[t] :
+            0;
+    }
+    pthread_mutex_unlock(&game->lock);
+}
+
+// The game polls a duplicate, it closes it with its other listeners
+int host_game_listener(host_game_t *game)
+{
+    return fcntl(game->wake_fd, F_DUPFD_CLOEXEC, 0);
+}
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/host_internal.h
+** File description:
+** Structures shared by the host, its lobby and its game threads
+*/
+
+#ifndef HOST_INTERNAL_H_
+    #define HOST_INTERNAL_H_
+
+    #include <pthread.h>
+    #include <stdatomic.h>
+
+    #include "server/host.h"
+
+// line is the routing line the game runs first, NULL after a GAME command
+typedef struct host_handoff_s {
+    int fd;
+    char *line;
+} host_handoff_t;
+
+// The inbox, seats and routed are shared by both sides under lock. seats,
+// indexed by team, is what the game last published as free, less what the
+// lobby routed to it since; routed counts the players the lobby sent that
+// are still in the inbox. played counts the games finished in the slot.
+struct host_game_s {
+    server_config_t config;
+    size_t index;
+    uint64_t seed_step;
+    pthread_t thread;
+    bool started;
+    pthread_mutex_t lock;
+    host_handoff_t *inbox;
+    size_t inbox_count;
+    size_t inbox_capacity;
+    int wake_fd;
+    atomic_bool stop;
+    atomic_uint_fast64_t played;
+    size_t *seats;
+    size_t *routed;
+};
+
+// accepted is when the connection came in, see LOBBY_TIMEOUT
+typedef struct lobby_conn_s {
+    int fd;
+    double accepted;
+    size_t len;
+    char line[LOBBY_LINE_MAX];
+} lobby_conn_t;
+
+// fds[0] and fds[1] are the listeners, lobby connection i polls at i + 2
+typedef struct host_s {
+    server_config_t config;
+    int server_fd;
+    int unix_fd;
+    int signal_fd;
+    host_game_t *games;
+    size_t game_count;
+    lobby_conn_t *lobby;
+    size_t lobby_count;
+    size_t lobby_capacity;
+    size_t lobby_limit;
+    struct pollfd *fds;
+} host_t;
+
+// host_game.c
+int host_game_start(host_t *host, host_game_t *game);
+void host_game_stop(host_game_t *game);
+int host_game_hand_off(host_game_t *game, int fd, const char *line);
+
+// lobby.c
+void lobby_init(host_t *host);
+void lobby_accept(host_t *host, int listen_fd);
+void lobby_read(host_t *host, size_t index);
+void lobby_expire(host_t *host);
+void lobby_destroy(host_t *host);
+
+// lobby_route.c: the game a "GAME k", team or GRAPHIC line goes to, NULL
+// when there is none. A seat taken for a client the game never got is
+// given back with lobby_return_seat.
+host_game_t *lobby_pick_game(host_t *host, const char *line);
+void lobby_return_seat(host_t *host, host_game_t *game, const char *line);
+
+#endif /* !HOST_INTERNAL_H_ */
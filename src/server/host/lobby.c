@@ -0,0 +1,178 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/lobby.c
+** File description:
+** Connections waiting to be routed to a game
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+
+#include "host_internal.h"
+
+static void send_text(int fd, const char *text)
+{
+    if (send(fd, text, strlen(text), MSG_NOSIGNAL) == -1)
+        LOG_DEBUG("[HOST] Lobby reply lost on fd:%d", fd);
+}
+
+// Byte by byte so nothing past the routing line leaves the socket
+static int read_line(lobby_conn_t *conn)
+{
+    char c;
+    ssize_t n = recv(conn->fd, &c, 1, 0);
+
+    for (; n == 1; n = recv(conn->fd, &c, 1, 0)) {
+        if (c == '\n')
+            break;
+        if (conn->len + 1 >= LOBBY_LINE_MAX)
+            return -1;
+        conn->line[conn->len] = c;
+        conn->len++;
+    }
+    if (n == 0 || (n == -1 && errno != EAGAIN && errno != EINTR))
+        return -1;
+    if (n == -1)
+        return 0;
+    if (conn->len > 0 && conn->line[conn->len - 1] == '\r')
+        conn->len--;
+    conn->line[conn->len] = '\0';
+    return 1;
+}
+
+static int grow_lobby(host_t *host)
+{
+    size_t capacity = host->lobby_capacity ? host->lobby_capacity * 2 : 16;
+    lobby_conn_t *lobby;
+    struct pollfd *fds;
+
+    if (host->lobby_count < host->lobby_capacity)
+        return 0;
+    lobby = realloc(host->lobby, capacity * sizeof(*lobby));
+    if (!lobby)
+        return -1;
+    host->lobby = lobby;
+    fds = realloc(host->fds, (capacity + 2) * sizeof(*fds));
+    if (!fds)
+        return -1;
+    host->fds = fds;
+    host->lobby_capacity = capacity;
+    return 0;
+}
+
+// Run once the games are up, they raise the descriptor limit on creation
+void lobby_init(host_t *host)
+{
+    struct rlimit limit;
+
+    host->lobby_limit = 1;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == -1 ||
+        limit.rlim_cur <= RESERVED_FDS)
+        return;
+    if (limit.rlim_cur == RLIM_INFINITY || limit.rlim_cur > MAX_FD_LIMIT)
+        limit.rlim_cur = MAX_FD_LIMIT;
+    host->lobby_limit = (limit.rlim_cur - RESERVED_FDS) / LOBBY_FD_SHARE;
+    if (host->lobby_limit == 0)
+        host->lobby_limit = 1;
+}
+
+static int accept_one(host_t *host, int listen_fd)
+{
+    int fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK);
+
+    if (fd == -1) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            LOG_WARN("[HOST] Accept failed: %s", strerror(errno));
+        return -1;
+    }
+    if (host->lobby_count >= host->lobby_limit || grow_lobby(host) == -1) {
+        LOG_WARN("[HOST] Lobby is full");
+        close(fd);
+        return 0;
+    }
+    host->lobby[host->lobby_count].fd = fd;
+    host->lobby[host->lobby_count].accepted = get_current_time();
+    host->lobby[host->lobby_count].len = 0;
+    host->lobby_count++;
+    send_text(fd, "WELCOME\n");
+    return 0;
+}
+
+void lobby_accept(host_t *host, int listen_fd)
+{
+    while (accept_one(host, listen_fd) == 0);
+}
+
+// Removal swaps the last connection in, the host walks the lobby backwards
+static void remove_conn(host_t *host, size_t index)
+{
+    host->lobby_count--;
+    if (index != host->lobby_count)
+        host->lobby[index] = host->lobby[host->lobby_count];
+}
+
+// Returns false when the client has to try another line
+static bool route(host_t *host, lobby_conn_t *conn)
+{
+    bool command = strncmp(conn->line, LOBBY_COMMAND,
+        strlen(LOBBY_COMMAND)) == 0;
+    host_game_t *game = lobby_pick_game(host, conn->line);
+
+    if (!game) {
+        send_text(conn->fd, "ko\n");
+        return false;
+    }
+    if (command)
+        send_text(conn->fd, "ok\n");
+    if (host_game_hand_off(game, conn->fd, command ? NULL : conn->line)
+        == -1) {
+        LOG_WARN("[HOST] Failed to hand client over to game %zu",
+            game->index);
+        lobby_return_seat(host, game, conn->line);
+        close(conn->fd);
+    }
+    return true;
+}
+
+void lobby_read(host_t *host, size_t index)
+{
+    lobby_conn_t *conn = &host->lobby[index];
+    int status = read_line(conn);
+
+    if (status == 0)
+        return;
+    if (status == 1 && !route(host, conn)) {
+        conn->len = 0;
+        return;
+    }
+    if (status == -1)
+        close(conn->fd);
+    remove_conn(host, index);
+}
+
+// Backwards, as a removal swaps the last connection in
+void lobby_expire(host_t *host)
+{
+    double now = get_current_time();
+
+    for (size_t i = host->lobby_count; i > 0; --i) {
+        if (now - host->lobby[i - 1].accepted < LOBBY_TIMEOUT)
+            continue;
+        LOG_DEBUG("[HOST] Lobby fd:%d timed out", host->lobby[i - 1].fd);
+        close(host->lobby[i - 1].fd);
+        remove_conn(host, i - 1);
+    }
+}
+
+void lobby_destroy(host_t *host)
+{
+    for (size_t i = 0; i < host->lobby_count; ++i)
+        close(host->lobby[i].fd);
+    free(host->lobby);
+    host->lobby = NULL;
+    host->lobby_count = 0;
+    host->lobby_capacity = 0;
+}
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/host/lobby_route.c
+** File description:
+** Picks the game a lobby connection is sent to
+*/
+
+#include <string.h>
+
+#include "host_internal.h"
+
+static host_game_t *game_by_index(host_t *host, const char *text)
+{
+    char *end;
+    size_t index = strtoul(text, &end, 10);
+
+    if (end == text || *end != '\0' || text[0] == '-' ||
+        index >= host->game_count ||
+        atomic_load(&host->games[index].stop))
+        return NULL;
+    return &host->games[index];
+}
+
+static int find_team(const server_config_t *config, const char *name)
+{
+    for (size_t t = 0; t < config->team_count; ++t) {
+        if (strcmp(config->team_names[t], name) == 0)
+            return (int)t;
+    }
+    return -1;
+}
+
+// A seat is taken from what the game last published and given back by
+// the game itself, which publishes again once it has seen the player
+static bool take_seat(host_game_t *game, size_t team)
+{
+    bool taken;
+
+    if (atomic_load(&game->stop))
+        return false;
+    pthread_mutex_lock(&game->lock);
+    taken = game->seats[team] > 0;
+    if (taken) {
+        game->seats[team]--;
+        game->routed[team]++;
+    }
+    pthread_mutex_unlock(&game->lock);
+    return taken;
+}
+
+// Only a team line took a seat. If the game swapped its inbox since, routed
+// is back to 0 and the next publish already counts the seat as free.
+void lobby_return_seat(host_t *host, host_game_t *game, const char *line)
+{
+    int team = find_team(&host->config, line);
+
+    if (team < 0 || strcmp(line, "GRAPHIC") == 0 ||
+        strncmp(line, LOBBY_COMMAND, strlen(LOBBY_COMMAND)) == 0)
+        return;
+    pthread_mutex_lock(&game->lock);
+    if (game->routed[team] > 0) {
+        game->routed[team]--;
+        game->seats[team]++;
+    }
+    pthread_mutex_unlock(&game->lock);
+}
+
+// Players fill the slots in order, so games start as soon as they can
+host_game_t *lobby_pick_game(host_t *host, const char *line)
+{
+    int team;
+
+    if (strncmp(line, LOBBY_COMMAND, strlen(LOBBY_COMMAND)) == 0)
+        return game_by_index(host, line + strlen(LOBBY_COMMAND));
+    if (strcmp(line, "GRAPHIC") == 0)
+        return atomic_load(&host->games[0].stop) ? NULL : &host->games[0];
+    team = find_team(&host->config, line);
+    if (team < 0)
+        return NULL;
+    for (size_t i = 0; i < host->game_count; ++i) {
+        if (take_seat(&host->games[i], team))
+            return &host->games[i];
+    }
+    return NULL;
+}
@@ -14,6 +14,9 @@
 #include "server/server.h"
 #include "server/payloads.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
+#include "server/team.h"
+#include "server/map.h"
 
 static const int incantation_requirements[8][7] = {
     {1, 0, 0, 0, 0, 0, 0}, // Level 1 (unused)
@@ -26,9 +29,11 @@ static const int incantation_requirements[8][7] = {
     {6, 2, 2, 2, 2, 2, 1}, // Level 8
 };
 
-tile_t *get_player_tile(server_t *server, player_t *p)
+// The occupant list is kept in step with x/y by player_set_position
+tile_id_t get_player_tile(server_t *server, player_t *p)
 {
-    return map_get_tile(server->game->map, p->x, p->y);
+    (void)server;
+    return p ? p->tile : TILE_NONE;
 }
 
 static int get_player_level(player_t *p)
@@ -36,33 +41,24 @@ static int get_player_level(player_t *p)
     return p ? p->level : 1;
 }
 
-static void gather_players_on_tile(struct reqplayer_ctx *ctx)
+// Walks the occupants of the tile only, dead players are unlinked by
+// player_die
+static int count_ready_players(const map_t *map, tile_id_t tile, int level)
 {
-    int n = 0;
-    player_t *p;
+    int count = 0;
 
-    for (size_t i = 0; i < ctx->server->game->player_count; ++i) {
-        p = ctx->server->game->players[i];
-        if (p && p->x == ctx->tile->players[0]->x &&
-            p->y == ctx->tile->players[0]->y
-            && p->level == ctx->level && p->is_alive) {
-            ctx->out[n] = p;
-            ++n;
-        }
+    for (player_t *p = map_occupants(map, tile); p; p = p->tile_next) {
+        if (p->level == level && p->is_alive)
+            count++;
     }
-    *ctx->count = n;
+    return count;
 }
 
-static bool has_required_players(struct reqplayer_ctx *ctx)
-{
-    gather_players_on_tile(ctx);
-    return *ctx->count >= ctx->required;
-}
-
-static bool has_required_resources(tile_t *tile, const int *reqs)
+static bool has_required_resources(const map_t *map, tile_id_t tile,
+    const int *reqs)
 {
     for (int i = 1; i < 7; ++i) {
-        if (tile->resources[i] < reqs[i])
+        if (map_stack(map, tile, i) < reqs[i])
             return false;
     }
     return true;
@@ -71,29 +67,26 @@ static bool has_required_resources(tile_t *tile, const int *reqs)
 static void remove_resources(incantation_ctx_t *ctx, const int *reqs)
 {
     for (int i = 1; i < 7; ++i)
-        ctx->tile->resources[i] -= reqs[i];
-    broadcast_tile_to_guis(ctx->server, ctx->tile->x, ctx->tile->y);
+        map_add_resource(ctx->server->game->map, ctx->tile, i, -reqs[i]);
+    map_mark_dirty(ctx->server->game->map, ctx->tile);
 }
 
 bool incantation_requirements_met(server_t *server, player_t *player)
 {
-    tile_t *tile;
+    tile_id_t tile;
     int level;
-    player_t *players[8] = {0};
-    int player_count = 0;
     const int *reqs;
 
     if (!server || !player)
         return false;
     tile = get_player_tile(server, player);
     level = get_player_level(player);
-    if (level < 1 || level > 7 || !tile)
+    if (level < 1 || level > 7 || tile == TILE_NONE)
         return false;
     reqs = incantation_requirements[level];
-    if (!has_required_players(&(struct reqplayer_ctx){ server,
-            tile, level, reqs[0], players, &player_count }))
+    if (count_ready_players(server->game->map, tile, level) < reqs[0])
         return false;
-    if (!has_required_resources(tile, reqs))
+    if (!has_required_resources(server->game->map, tile, reqs))
         return false;
     return true;
 }
@@ -101,18 +94,27 @@ bool incantation_requirements_met(server_t *server, player_t *player)
 static int do_incantation(incantation_ctx_t *ctx)
 {
     remove_resources(ctx, ctx->reqs);
-    ctx->initiator->level++;
+    team_level_up(ctx->server->game, ctx->initiator);
     broadcast_message_to_guis(ctx->server, ctx->initiator, gui_payload_plv);
     broadcast_message_to_guis(ctx->server, ctx->initiator, gui_payload_pin);
     broadcast_message_to_guis(ctx->server,
         ctx->initiator, gui_payload_pie_success);
+    journal_player(ctx->server, JOURNAL_PLV, ctx->initiator);
+    journal_incantation(ctx->server, JOURNAL_PIE, ctx->initiator, true);
     return 1;
 }
 
+static int fail_incantation(server_t *server, player_t *player)
+{
+    broadcast_message_to_guis(server, player, gui_payload_pie_failed);
+    journal_incantation(server, JOURNAL_PIE, player, false);
+    return 0;
+}
+
 int try_incantation(server_t *server, client_t *client)
 {
     player_t *p;
-    tile_t *tile;
+    tile_id_t tile;
     int level;
     incantation_ctx_t ctx;
     const int *reqs;
@@ -122,13 +124,11 @@ int try_incantation(server_t *server, client_t *client)
     p = client->player;
     tile = get_player_tile(server, p);
     level = get_player_level(p);
-    if (level < 1 || level > 7 || !tile)
+    if (level < 1 || level > 7 || tile == TILE_NONE)
         return 0;
     reqs = incantation_requirements[level];
-    ctx = (incantation_ctx_t){ server, p, tile, level, reqs, {p}, reqs[0] };
-    if (!incantation_requirements_met(server, p)) {
-        broadcast_message_to_guis(server, p, gui_payload_pie_failed);
-        return 0;
-    }
+    ctx = (incantation_ctx_t){ server, p, tile, level, reqs };
+    if (!incantation_requirements_met(server, p))
+        return fail_incantation(server, p);
     return do_incantation(&ctx);
 }
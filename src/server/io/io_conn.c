@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_conn.c
+** File description:
+** Connections owned by an I/O thread
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include "io_internal.h"
+
+static int map_slot(io_thread_t *thread, size_t key, io_conn_t *conn)
+{
+    size_t size = thread->slot_capacity;
+    io_conn_t **map;
+
+    while (size <= key)
+        size = size ? size * 2 : CLIENT_SLAB_SIZE;
+    if (size != thread->slot_capacity) {
+        map = realloc(thread->by_slot, size * sizeof(*map));
+        if (!map)
+            return -1;
+        memset(map + thread->slot_capacity, 0,
+            (size - thread->slot_capacity) * sizeof(*map));
+        thread->by_slot = map;
+        thread->slot_capacity = size;
+    }
+    thread->by_slot[key] = conn;
+    return 0;
+}
+
+static int reserve_conn(io_thread_t *thread)
+{
+    size_t capacity = thread->capacity;
+    io_conn_t **conns;
+    struct pollfd *fds;
+
+    if (thread->count < capacity)
+        return 0;
+    capacity = capacity ? capacity * 2 : CLIENT_SLAB_SIZE;
+    conns = realloc(thread->conns, capacity * sizeof(*conns));
+    if (!conns)
+        return -1;
+    thread->conns = conns;
+    fds = realloc(thread->fds, (capacity + 1) * sizeof(*fds));
+    if (!fds)
+        return -1;
+    thread->fds = fds;
+    thread->capacity = capacity;
+    return 0;
+}
+
+io_conn_t *io_conn_add(io_thread_t *thread, const io_message_t *msg)
+{
+    io_conn_t *conn = calloc(1, sizeof(*conn));
+
+    if (!conn || reserve_conn(thread) == -1 ||
+        map_slot(thread, msg->slot / thread->pool->count, conn) == -1) {
+        free(conn);
+        return NULL;
+    }
+    fcntl(msg->fd, F_SETFL, fcntl(msg->fd, F_GETFL) | O_NONBLOCK);
+    conn->fd = msg->fd;
+    conn->slot = msg->slot;
+    conn->generation = msg->generation;
+    conn->index = thread->count;
+    thread->conns[thread->count] = conn;
+    thread->fds[thread->count + 1] = (struct pollfd){msg->fd, POLLIN, 0};
+    thread->count++;
+    return conn;
+}
+
+io_conn_t *io_conn_find(const io_thread_t *thread, size_t slot,
+    uint32_t generation)
+{
+    size_t key = slot / thread->pool->count;
+    io_conn_t *conn;
+
+    if (key >= thread->slot_capacity)
+        return NULL;
+    conn = thread->by_slot[key];
+    if (!conn || conn->generation != generation)
+        return NULL;
+    return conn;
+}
+
+void io_conn_release(io_thread_t *thread, io_conn_t *conn)
+{
+    size_t key = conn->slot / thread->pool->count;
+    size_t last = thread->count - 1;
+
+    if (key < thread->slot_capacity && thread->by_slot[key] == conn)
+        thread->by_slot[key] = NULL;
+    thread->conns[conn->index] = thread->conns[last];
+    thread->conns[conn->index]->index = conn->index;
+    thread->fds[conn->index + 1] = thread->fds[last + 1];
+    thread->count--;
+    close(conn->fd);
+    free(conn->rx);
+    free(conn->tx);
+    free(conn);
+}
+
+int io_conn_queue(io_conn_t *conn, const char *data, size_t len)
+{
+    size_t size = conn->tx_size ? conn->tx_size : BUFFER_SIZE;
+    char *tx;
+
+    if (conn->tx_len + len > IO_MAX_PENDING)
+        return -1;
+    while (size < conn->tx_len + len)
+        size *= 2;
+    if (size != conn->tx_size) {
+        tx = realloc(conn->tx, size);
+        if (!tx)
+            return -1;
+        conn->tx = tx;
+        conn->tx_size = size;
+    }
+    memcpy(conn->tx + conn->tx_len, data, len);
+    conn->tx_len += len;
+    return 0;
+}
+
+// Everything queued since the last call goes out in as few sends as the
+// socket allows
+int io_conn_flush(io_conn_t *conn)
+{
+    ssize_t sent;
+
+    while (conn->tx_len > 0) {
+        sent = send(conn->fd, conn->tx, conn->tx_len, MSG_NOSIGNAL);
+        if (sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return 0;
+        if (sent == -1 && errno == EINTR)
+            continue;
+        if (sent <= 0)
+            return -1;
+        memmove(conn->tx, conn->tx + sent, conn->tx_len - sent);
+        conn->tx_len -= sent;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_conn_read.c
+** File description:
+** Receiving and splitting lines on an I/O thread
+*/
+
+#include <errno.h>
+#include <sys/socket.h>
+
+#include "io_internal.h"
+
+static io_message_t *claim_inbound(io_thread_t *thread, io_conn_t *conn,
+    io_kind_t kind, size_t *ticket)
+{
+    io_message_t *msg = mpsc_ring_claim(&thread->pool->inbound, ticket);
+
+    if (!msg)
+        return NULL;
+    msg->kind = kind;
+    msg->slot = conn->slot;
+    msg->generation = conn->generation;
+    msg->fd = conn->fd;
+    msg->len = 0;
+    msg->heap = NULL;
+    msg->text[0] = '\0';
+    return msg;
+}
+
+static int push_line(io_thread_t *thread, io_conn_t *conn,
+    const char *line, size_t len)
+{
+    size_t ticket;
+    io_message_t *msg = claim_inbound(thread, conn, IO_LINE, &ticket);
+
+    if (!msg)
+        return -1;
+    io_message_set_text(msg, line, len);
+    mpsc_ring_publish(&thread->pool->inbound, ticket);
+    thread->pushed = true;
+    return 0;
+}
+
+int io_conn_push_closed(io_thread_t *thread, io_conn_t *conn)
+{
+    size_t ticket;
+
+    if (!claim_inbound(thread, conn, IO_CLOSED, &ticket))
+        return -1;
+    mpsc_ring_publish(&thread->pool->inbound, ticket);
+    thread->pushed = true;
+    conn->close_sent = true;
+    return 0;
+}
+
+// Lines that do not fit in a full inbound queue stay in rx and are retried
+// on the next iteration; the game thread may be waiting on us meanwhile
+void io_conn_split(io_thread_t *thread, io_conn_t *conn)
+{
+    size_t start = 0;
+    char *newline = memchr(conn->rx, '\n', conn->rx_len);
+
+    conn->stalled = false;
+    while (newline) {
+        if (push_line(thread, conn, conn->rx + start,
+            newline - (conn->rx + start)) == -1) {
+            conn->stalled = true;
+            break;
+        }
+        start = newline - conn->rx + 1;
+        newline = memchr(conn->rx + start, '\n', conn->rx_len - start);
+    }
+    memmove(conn->rx, conn->rx + start, conn->rx_len - start);
+    conn->rx_len -= start;
+}
+
+// A line longer than MAX_LINE_LENGTH is treated like a broken connection
+int io_conn_read(io_thread_t *thread, io_conn_t *conn)
+{
+    ssize_t received;
+
+    if (!conn->rx) {
+        conn->rx = malloc(MAX_LINE_LENGTH);
+        if (!conn->rx)
+            return -1;
+        conn->rx_size = MAX_LINE_LENGTH;
+    }
+    if (conn->rx_len == conn->rx_size)
+        return -1;
+    received = recv(conn->fd, conn->rx + conn->rx_len,
+        conn->rx_size - conn->rx_len, MSG_DONTWAIT);
+    if (received == -1)
+        return (errno == EAGAIN || errno == EWOULDBLOCK ||
+            errno == EINTR) ? 0 : -1;
+    if (received == 0)
+        return -1;
+    conn->rx_len += received;
+    io_conn_split(thread, conn);
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_internal.h
+** File description:
+** Structures shared by the I/O pool and its threads
+*/
+
+#ifndef IO_INTERNAL_H_
+    #define IO_INTERNAL_H_
+
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <string.h>
+    #include <unistd.h>
+
+    #include "server/io_pool.h"
+    #include "server/mpsc_ring.h"
+
+typedef enum io_kind_e {
+    IO_ATTACH,
+    IO_DATA,
+    IO_DETACH,
+    IO_LINE,
+    IO_CLOSED
+} io_kind_t;
+
+// Payloads longer than the inline text are moved to the heap and freed by
+// whoever consumes the message
+typedef struct io_message_s {
+    io_kind_t kind;
+    uint32_t generation;
+    size_t slot;
+    int fd;
+    size_t len;
+    char *heap;
+    char text[IO_INLINE_SIZE];
+} io_message_t;
+
+typedef struct io_conn_s {
+    int fd;
+    size_t slot;
+    uint32_t generation;
+    size_t index;
+    char *rx;
+    size_t rx_len;
+    size_t rx_size;
+    char *tx;
+    size_t tx_len;
+    size_t tx_size;
+    bool closed;
+    bool close_sent;
+    bool detached;
+    bool stalled;
+} io_conn_t;
+
+// conns[i] polls at fds[i + 1], fds[0] is the wake-up eventfd.
+// by_slot is indexed by slot / pool->count and only holds attached conns.
+struct io_thread_s {
+    pthread_t thread;
+    io_pool_t *pool;
+    mpsc_ring_t outbound;
+    int wake_fd;
+    atomic_bool wake_pending;
+    io_conn_t **conns;
+    struct pollfd *fds;
+    size_t count;
+    size_t capacity;
+    io_conn_t **by_slot;
+    size_t slot_capacity;
+    size_t stalled;
+    bool pushed;
+};
+
+struct io_pool_s {
+    io_thread_t *threads;
+    size_t count;
+    mpsc_ring_t inbound;
+    int wake_fd;
+    atomic_bool wake_pending;
+    atomic_bool running;
+};
+
+void *io_thread_main(void *arg);
+
+io_conn_t *io_conn_add(io_thread_t *thread, const io_message_t *msg);
+io_conn_t *io_conn_find(const io_thread_t *thread, size_t slot,
+    uint32_t generation);
+void io_conn_release(io_thread_t *thread, io_conn_t *conn);
+int io_conn_queue(io_conn_t *conn, const char *data, size_t len);
+int io_conn_flush(io_conn_t *conn);
+
+int io_conn_read(io_thread_t *thread, io_conn_t *conn);
+void io_conn_split(io_thread_t *thread, io_conn_t *conn);
+int io_conn_push_closed(io_thread_t *thread, io_conn_t *conn);
+
+// Only the first producer after the consumer went idle pays for the write
+static inline void io_wake(int fd, atomic_bool *pending)
+{
+    uint64_t one = 1;
+    ssize_t ret;
+
+    if (atomic_exchange(pending, true))
+        return;
+    ret = write(fd, &one, sizeof(one));
+    (void)ret;
+}
+
+// Consumer side, called before draining so no wake-up can be lost
+static inline void io_clear_wake(int fd, atomic_bool *pending, bool readable)
+{
+    uint64_t value;
+    ssize_t ret;
+
+    if (readable) {
+        ret = read(fd, &value, sizeof(value));
+        (void)ret;
+    }
+    atomic_store(pending, false);
+}
+
+static inline int io_message_set_text(io_message_t *msg, const char *data,
+    size_t len)
+{
+    char *dest = msg->text;
+
+    msg->heap = NULL;
+    msg->len = len;
+    if (len >= IO_INLINE_SIZE) {
+        msg->heap = malloc(len + 1);
+        dest = msg->heap;
+    }
+    if (!dest) {
+        msg->len = 0;
+        msg->text[0] = '\0';
+        return -1;
+    }
+    memcpy(dest, data, len);
+    dest[len] = '\0';
+    return 0;
+}
+
+static inline const char *io_message_text(const io_message_t *msg)
+{
+    return msg->heap ? msg->heap : msg->text;
+}
+
+static inline void io_discard_messages(mpsc_ring_t *ring)
+{
+    io_message_t *msg = mpsc_ring_peek(ring);
+
+    while (msg) {
+        free(msg->heap);
+        mpsc_ring_release(ring);
+        msg = mpsc_ring_peek(ring);
+    }
+}
+
+#endif /* !IO_INTERNAL_H_ */
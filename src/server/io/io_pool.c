@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_pool.c
+** File description:
+** I/O thread pool creation and teardown
+*/
+
+#include <sys/eventfd.h>
+
+#include "io_internal.h"
+#include "server/thread.h"
+
+static void release_thread(io_thread_t *thread)
+{
+    io_discard_messages(&thread->outbound);
+    mpsc_ring_destroy(&thread->outbound);
+    close(thread->wake_fd);
+    free(thread->fds);
+}
+
+static int init_thread(io_pool_t *pool, io_thread_t *thread)
+{
+    thread->pool = pool;
+    thread->fds = calloc(1, sizeof(*thread->fds));
+    if (!thread->fds)
+        return -1;
+    thread->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (thread->wake_fd == -1) {
+        free(thread->fds);
+        return -1;
+    }
+    if (mpsc_ring_init(&thread->outbound, IO_OUTBOUND_SLOTS,
+        sizeof(io_message_t)) == -1) {
+        close(thread->wake_fd);
+        free(thread->fds);
+        return -1;
+    }
+    thread->fds[0].fd = thread->wake_fd;
+    thread->fds[0].events = POLLIN;
+    return 0;
+}
+
+static int spawn_thread(io_pool_t *pool, io_thread_t *thread)
+{
+    if (init_thread(pool, thread) == -1)
+        return -1;
+    if (thread_spawn_unsignaled(&thread->thread, io_thread_main,
+        thread) == -1) {
+        release_thread(thread);
+        return -1;
+    }
+    return 0;
+}
+
+static io_pool_t *create_pool(size_t count)
+{
+    io_pool_t *pool = calloc(1, sizeof(*pool));
+
+    if (!pool)
+        return NULL;
+    pool->threads = calloc(count, sizeof(io_thread_t));
+    pool->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (!pool->threads || pool->wake_fd == -1 ||
+        mpsc_ring_init(&pool->inbound, IO_INBOUND_SLOTS,
+        sizeof(io_message_t)) == -1) {
+        if (pool->wake_fd != -1)
+            close(pool->wake_fd);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    atomic_store(&pool->running, true);
+    return pool;
+}
+
+int io_pool_create(server_t *server)
+{
+    size_t count = server->config.io_threads;
+
+    if (count == 0)
+        return 0;
+    server->io = create_pool(count);
+    if (!server->io)
+        return -1;
+    while (server->io->count < count) {
+        if (spawn_thread(server->io,
+            &server->io->threads[server->io->count]) == -1) {
+            io_pool_destroy(server);
+            return -1;
+        }
+        server->io->count++;
+    }
+    LOG_INFO("[SERVER] I/O threads: %zu", count);
+    return 0;
+}
+
+// Threads flush what they can and close their sockets on the way out
+void io_pool_destroy(server_t *server)
+{
+    io_pool_t *pool = server->io;
+    uint64_t one = 1;
+    ssize_t ret;
+
+    if (!pool)
+        return;
+    atomic_store(&pool->running, false);
+    for (size_t i = 0; i < pool->count; ++i) {
+        ret = write(pool->threads[i].wake_fd, &one, sizeof(one));
+        (void)ret;
+        pthread_join(pool->threads[i].thread, NULL);
+        release_thread(&pool->threads[i]);
+    }
+    io_discard_messages(&pool->inbound);
+    mpsc_ring_destroy(&pool->inbound);
+    close(pool->wake_fd);
+    free(pool->threads);
+    free(pool);
+    server->io = NULL;
+}
+
+size_t io_pool_inbound_depth(const server_t *server)
+{
+    return mpsc_ring_depth(&server->io->inbound);
+}
+
+size_t io_pool_outbound_depth(const server_t *server, size_t i)
+{
+    return mpsc_ring_depth(&server->io->threads[i].outbound);
+}
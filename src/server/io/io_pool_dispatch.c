@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_pool_dispatch.c
+** File description:
+** Game thread side of the inbound queue
+*/
+
+#include <errno.h>
+#include <string.h>
+
+#include "server/client_slab.h"
+#include "server/metrics.h"
+#include "io_internal.h"
+
+static void handle_inbound(server_t *server, const io_message_t *msg)
+{
+    client_t *client = client_from_slot(server, msg->slot);
+
+    if (!client || client->fd == -1 || client->generation != msg->generation)
+        return;
+    if (msg->kind == IO_CLOSED) {
+        client_remove(server, client);
+        return;
+    }
+    client_process_command(server, client, io_message_text(msg));
+}
+
+// Bounded so a flood of lines cannot hold back the next tick forever
+static void dispatch_inbound(server_t *server)
+{
+    mpsc_ring_t *inbound = &server->io->inbound;
+    io_message_t *msg = mpsc_ring_peek(inbound);
+
+    for (size_t n = 0; msg && n < IO_INBOUND_SLOTS; ++n) {
+        handle_inbound(server, msg);
+        free(msg->heap);
+        mpsc_ring_release(inbound);
+        msg = mpsc_ring_peek(inbound);
+    }
+}
+
+static void accept_ready(server_t *server, const struct pollfd *fds,
+    size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        if (fds[i].revents & POLLIN)
+            network_accept_connections(server, fds[i].fd);
+    }
+}
+
+// Only the work after a wake-up counts as the poll phase, not the wait
+// nor the admin queries
+static void handle_ready(server_t *server, struct pollfd *fds, bool timed)
+{
+    uint64_t started;
+
+    metrics_admin_handle(server, &fds[3]);
+    started = metrics_start(server);
+    io_clear_wake(server->io->wake_fd, &server->io->wake_pending,
+        fds[0].revents & POLLIN);
+    accept_ready(server, fds + 1, 2);
+    dispatch_inbound(server);
+    if (timed)
+        metrics_lap(server, METRICS_POLL, started);
+}
+
+int io_pool_poll(server_t *server, const struct timespec *timeout)
+{
+    struct pollfd fds[4] = {
+        {server->io->wake_fd, POLLIN, 0},
+        {server->server_fd, POLLIN, 0},
+        {server->unix_fd, POLLIN, 0},
+        metrics_admin_pollfd(server)
+    };
+    int ready = ppoll(fds, 4, timeout, NULL);
+
+    if (ready == -1) {
+        if (errno == EINTR)
+            return 0;
+        LOG_ERROR("[SERVER] Poll error: %s", strerror(errno));
+        return -1;
+    }
+    handle_ready(server, fds, ready > 0);
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_pool_send.c
+** File description:
+** Game thread side of the outbound queues
+*/
+
+#include <time.h>
+
+#include "io_internal.h"
+
+// The I/O thread drains its queue on every iteration and never waits on
+// the game thread, so backing off here cannot deadlock
+static io_message_t *claim_message(io_thread_t *thread, size_t *ticket)
+{
+    struct timespec backoff = {0, 50000};
+    io_message_t *msg = mpsc_ring_claim(&thread->outbound, ticket);
+
+    while (!msg) {
+        io_wake(thread->wake_fd, &thread->wake_pending);
+        nanosleep(&backoff, NULL);
+        msg = mpsc_ring_claim(&thread->outbound, ticket);
+    }
+    return msg;
+}
+
+static io_message_t *begin_message(client_t *client, io_kind_t kind,
+    size_t *ticket)
+{
+    io_message_t *msg = claim_message(client->io, ticket);
+
+    msg->kind = kind;
+    msg->slot = client->slot;
+    msg->generation = client->generation;
+    msg->fd = client->fd;
+    msg->len = 0;
+    msg->heap = NULL;
+    return msg;
+}
+
+static void end_message(client_t *client, size_t ticket)
+{
+    mpsc_ring_publish(&client->io->outbound, ticket);
+    io_wake(client->io->wake_fd, &client->io->wake_pending);
+}
+
+void io_pool_attach(server_t *server, client_t *client)
+{
+    size_t ticket;
+
+    client->io = &server->io->threads[client->slot % server->io->count];
+    begin_message(client, IO_ATTACH, &ticket);
+    end_message(client, ticket);
+}
+
+void io_pool_send(client_t *client, const char *data, size_t len)
+{
+    size_t ticket;
+    io_message_t *msg = begin_message(client, IO_DATA, &ticket);
+
+    if (io_message_set_text(msg, data, len) == -1)
+        LOG_WARN("[SERVER] Dropped %zu bytes for client %d", len, client->fd);
+    end_message(client, ticket);
+}
+
+// The socket stays open until the thread has flushed what was queued
+// before this message
+void io_pool_detach(client_t *client)
+{
+    size_t ticket;
+
+    begin_message(client, IO_DETACH, &ticket);
+    end_message(client, ticket);
+    client->io = NULL;
+}
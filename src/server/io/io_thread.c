@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/io/io_thread.c
+** File description:
+** I/O thread main loop
+*/
+
+#include "io_internal.h"
+
+static void attach_conn(io_thread_t *thread, const io_message_t *msg)
+{
+    io_conn_t orphan = {.fd = msg->fd, .slot = msg->slot,
+        .generation = msg->generation};
+
+    if (io_conn_add(thread, msg))
+        return;
+    LOG_ERROR("[SERVER] I/O thread cannot track client %d", msg->fd);
+    close(msg->fd);
+    io_conn_push_closed(thread, &orphan);
+}
+
+// The game thread has forgotten the client: its lines are no longer
+// wanted but what it queued before detaching still has to go out
+static void detach_conn(io_thread_t *thread, io_conn_t *conn)
+{
+    thread->by_slot[conn->slot / thread->pool->count] = NULL;
+    conn->detached = true;
+    conn->stalled = false;
+    conn->close_sent = true;
+    if (conn->closed || conn->tx_len == 0)
+        io_conn_release(thread, conn);
+}
+
+static void handle_outbound(io_thread_t *thread, const io_message_t *msg)
+{
+    io_conn_t *conn;
+
+    if (msg->kind == IO_ATTACH) {
+        attach_conn(thread, msg);
+        return;
+    }
+    conn = io_conn_find(thread, msg->slot, msg->generation);
+    if (!conn)
+        return;
+    if (msg->kind == IO_DETACH) {
+        detach_conn(thread, conn);
+        return;
+    }
+    if (!conn->closed &&
+        io_conn_queue(conn, io_message_text(msg), msg->len) == -1)
+        conn->closed = true;
+}
+
+static void drain_outbound(io_thread_t *thread)
+{
+    io_message_t *msg = mpsc_ring_peek(&thread->outbound);
+
+    for (size_t n = 0; msg && n < IO_OUTBOUND_SLOTS; ++n) {
+        handle_outbound(thread, msg);
+        free(msg->heap);
+        mpsc_ring_release(&thread->outbound);
+        msg = mpsc_ring_peek(&thread->outbound);
+    }
+}
+
+static void transfer(io_thread_t *thread, io_conn_t *conn, short revents)
+{
+    if (conn->stalled)
+        io_conn_split(thread, conn);
+    if (conn->closed || conn->detached)
+        return;
+    if (revents & POLLIN) {
+        if (io_conn_read(thread, conn) == -1)
+            conn->closed = true;
+    } else if (revents & (POLLERR | POLLHUP | POLLNVAL)) {
+        conn->closed = true;
+    }
+    if (!conn->closed && conn->tx_len > 0 && io_conn_flush(conn) == -1)
+        conn->closed = true;
+}
+
+// A closed socket leaves the poll set (negative fd) until the game thread
+// detaches it, otherwise POLLHUP would keep the thread spinning
+static void service_conn(io_thread_t *thread, io_conn_t *conn, short revents)
+{
+    struct pollfd *pfd;
+
+    transfer(thread, conn, revents);
+    if (conn->detached && conn->tx_len > 0 && !conn->closed &&
+        io_conn_flush(conn) == -1)
+        conn->closed = true;
+    if (conn->detached && (conn->closed || conn->tx_len == 0)) {
+        io_conn_release(thread, conn);
+        return;
+    }
+    if (conn->closed && !conn->close_sent && !conn->stalled)
+        io_conn_push_closed(thread, conn);
+    thread->stalled += conn->stalled;
+    pfd = &thread->fds[conn->index + 1];
+    pfd->fd = conn->closed ? -1 : conn->fd;
+    pfd->events = (conn->stalled || conn->detached ? 0 : POLLIN) |
+        (conn->tx_len > 0 ? POLLOUT : 0);
+}
+
+// Walks backwards so a release only ever swaps in a visited conn
+static void service_conns(io_thread_t *thread)
+{
+    size_t i = thread->count;
+
+    thread->stalled = 0;
+    while (i > 0) {
+        i--;
+        service_conn(thread, thread->conns[i], thread->fds[i + 1].revents);
+    }
+}
+
+static void close_all(io_thread_t *thread)
+{
+    drain_outbound(thread);
+    while (thread->count > 0) {
+        if (!thread->conns[thread->count - 1]->closed)
+            io_conn_flush(thread->conns[thread->count - 1]);
+        io_conn_release(thread, thread->conns[thread->count - 1]);
+    }
+    free(thread->conns);
+    free(thread->by_slot);
+}
+
+void *io_thread_main(void *arg)
+{
+    io_thread_t *thread = arg;
+    io_pool_t *pool = thread->pool;
+
+    while (atomic_load(&pool->running)) {
+        if (poll(thread->fds, thread->count + 1,
+            thread->stalled > 0 ? 1 : 100) == -1)
+            thread->fds[0].revents = 0;
+        io_clear_wake(thread->wake_fd, &thread->wake_pending,
+            thread->fds[0].revents & POLLIN);
+        drain_outbound(thread);
+        service_conns(thread);
+        if (thread->pushed) {
+            thread->pushed = false;
+            io_wake(pool->wake_fd, &pool->wake_pending);
+        }
+    }
+    close_all(thread);
+    return NULL;
+}
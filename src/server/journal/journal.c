@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/journal/journal.c
+** File description:
+** Journal file lifecycle and keyframes
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "server/snapshot.h"
+#include "journal_internal.h"
+
+static journal_t *create_journal(const char *path)
+{
+    journal_t *journal = calloc(1, sizeof(*journal));
+    uint32_t header[2] = {JOURNAL_MAGIC, JOURNAL_VERSION};
+
+    if (!journal)
+        return NULL;
+    journal->file = fopen(path, "wb");
+    if (!journal->file || mpsc_ring_init(&journal->ring, JOURNAL_RING_SLOTS,
+        sizeof(journal_slot_t)) == -1) {
+        if (journal->file)
+            fclose(journal->file);
+        free(journal);
+        return NULL;
+    }
+    setvbuf(journal->file, NULL, _IOFBF, JOURNAL_BUFFER_SIZE);
+    journal->failed = fwrite(header, sizeof(header), 1, journal->file) != 1;
+    journal->offset = sizeof(header);
+    return journal;
+}
+
+// The child streams the image to the writer thread through the pipe, like
+// a --snapshot writer it sees the game frozen by copy-on-write
+static void serialize_image(const server_t *server, int fds[2])
+{
+    FILE *stream;
+    bool failed;
+
+    close(fds[0]);
+    stream = fdopen(fds[1], "wb");
+    if (!stream)
+        _exit(1);
+    setvbuf(stream, NULL, _IOFBF, JOURNAL_COPY_SIZE);
+    failed = snapshot_serialize(server, stream) == -1;
+    _exit(fclose(stream) != 0 || failed);
+}
+
+// Returns the read end of the image pipe, -1 when no child could be forked
+static int fork_serializer(const server_t *server, pid_t *pid)
+{
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC) == -1)
+        return -1;
+    *pid = fork();
+    if (*pid == 0)
+        serialize_image(server, fds);
+    close(fds[1]);
+    if (*pid == -1) {
+        close(fds[0]);
+        return -1;
+    }
+    return fds[0];
+}
+
+static void take_keyframe(server_t *server)
+{
+    double started = get_current_time();
+    pid_t pid = 0;
+    int fd = fork_serializer(server, &pid);
+    journal_slot_t *slot;
+    size_t ticket;
+
+    if (fd == -1) {
+        LOG_WARN("[JOURNAL] Keyframe of tick %llu lost: %s",
+            (unsigned long long)server->tick_count, strerror(errno));
+        return;
+    }
+    slot = journal_begin(server, JOURNAL_KEYFRAME, &ticket);
+    slot->image_fd = fd;
+    slot->image_pid = pid;
+    journal_commit(server, slot, slot->payload, ticket);
+    LOG_DEBUG("[JOURNAL] Keyframe of tick %llu forked in %.3f ms",
+        (unsigned long long)server->tick_count,
+        (get_current_time() - started) * 1e3);
+}
+
+int journal_open(server_t *server)
+{
+    journal_t *journal;
+
+    if (!server->config.journal_path)
+        return 0;
+    journal = create_journal(server->config.journal_path);
+    if (!journal || journal_writer_start(journal) == -1) {
+        LOG_ERROR("[JOURNAL] Cannot open %s", server->config.journal_path);
+        if (journal) {
+            fclose(journal->file);
+            mpsc_ring_destroy(&journal->ring);
+        }
+        free(journal);
+        return -1;
+    }
+    server->journal = journal;
+    take_keyframe(server);
+    return 0;
+}
+
+void journal_close(server_t *server)
+{
+    journal_t *journal = server->journal;
+    journal_slot_t *slot;
+    size_t ticket;
+    bool failed;
+
+    if (!journal)
+        return;
+    slot = journal_begin(server, JOURNAL_END, &ticket);
+    journal_commit(server, slot, slot->payload, ticket);
+    journal_writer_stop(journal);
+    failed = journal->failed || fflush(journal->file) != 0 ||
+        ftruncate(fileno(journal->file), journal->offset) != 0 ||
+        fsync(fileno(journal->file)) != 0;
+    if (fclose(journal->file) != 0 || failed)
+        LOG_ERROR("[JOURNAL] %s is incomplete", server->config.journal_path);
+    LOG_INFO("[JOURNAL] %llu records, %zu waits on a full ring",
+        (unsigned long long)journal->records, atomic_load(&journal->stalls));
+    mpsc_ring_destroy(&journal->ring);
+    free(journal);
+    server->journal = NULL;
+}
+
+void journal_tick(server_t *server)
+{
+    if (server->journal &&
+        server->tick_count % server->config.keyframe_every == 0)
+        take_keyframe(server);
+}
@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/journal/journal_events.c
+** File description:
+** Game events encoded into journal records
+*/
+
+#include "server/map.h"
+#include "journal_internal.h"
+
+void journal_player(server_t *server, journal_event_t event,
+    const player_t *player)
+{
+    size_t ticket;
+    journal_slot_t *slot = journal_begin(server, event, &ticket);
+    unsigned char *out;
+
+    if (!slot)
+        return;
+    out = journal_put(slot->payload, player->id, 4);
+    out = journal_put(out, player->x, 2);
+    out = journal_put(out, player->y, 2);
+    out = journal_put(out, player->orientation, 1);
+    out = journal_put(out, player->level, 1);
+    out = journal_put(out, player->team_id, 2);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+        out = journal_put(out, (uint32_t)player->resources[i], 4);
+    journal_commit(server, slot, out, ticket);
+}
+
+void journal_tile(server_t *server, tile_id_t tile)
+{
+    const map_t *map = server->game->map;
+    size_t ticket;
+    journal_slot_t *slot = journal_begin(server, JOURNAL_BCT, &ticket);
+    unsigned char *out;
+
+    if (!slot)
+        return;
+    out = journal_put(slot->payload, tile_x(map, tile), 2);
+    out = journal_put(out, tile_y(map, tile), 2);
+    for (int type = 0; type < RESOURCE_COUNT; ++type)
+        out = journal_put(out, map_stack(map, tile, type), 2);
+    journal_commit(server, slot, out, ticket);
+}
+
+void journal_incantation(server_t *server, journal_event_t event,
+    const player_t *initiator, bool success)
+{
+    size_t ticket;
+    journal_slot_t *slot = journal_begin(server, event, &ticket);
+    unsigned char *out;
+
+    if (!slot)
+        return;
+    out = journal_put(slot->payload, initiator->x, 2);
+    out = journal_put(out, initiator->y, 2);
+    out = journal_put(out, initiator->id, 4);
+    out = journal_put(out, initiator->level, 1);
+    out = journal_put(out, success, 1);
+    journal_commit(server, slot, out, ticket);
+}
+
+// Only a laid egg has a parent, hatching and dying carry the id alone
+void journal_egg(server_t *server, journal_event_t event, int egg_id,
+    const player_t *parent)
+{
+    size_t ticket;
+    journal_slot_t *slot = journal_begin(server, event, &ticket);
+    unsigned char *out;
+
+    if (!slot)
+        return;
+    out = journal_put(slot->payload, egg_id, 4);
+    if (parent) {
+        out = journal_put(out, parent->id, 4);
+        out = journal_put(out, parent->x, 2);
+        out = journal_put(out, parent->y, 2);
+    }
+    journal_commit(server, slot, out, ticket);
+}
+
+void journal_game_end(server_t *server, int team_id)
+{
+    size_t ticket;
+    journal_slot_t *slot = journal_begin(server, JOURNAL_SEG, &ticket);
+
+    if (slot)
+        journal_commit(server, slot,
+            journal_put(slot->payload, team_id, 2), ticket);
+}
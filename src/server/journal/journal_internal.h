@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/journal/journal_internal.h
+** File description:
+** Ring slots shared by the journal producers and its writer thread
+*/
+
+#ifndef JOURNAL_INTERNAL_H_
+    #define JOURNAL_INTERNAL_H_
+
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <sys/types.h>
+
+    #include "server/journal.h"
+    #include "server/mpsc_ring.h"
+
+    // The player record, the largest fixed payload
+    #define JOURNAL_PAYLOAD_MAX (4 + 2 + 2 + 1 + 1 + 2 + 4 * RESOURCE_COUNT)
+    #define JOURNAL_HEADER_SIZE (1 + 8)
+    #define JOURNAL_COPY_SIZE 65536
+    #define JOURNAL_CAPTURED SIZE_MAX
+
+// A keyframe carries the pipe its forked serializer writes the image to;
+// the writer thread copies it into the record and reaps the child
+typedef struct journal_slot_s {
+    uint8_t event;
+    uint8_t size;
+    uint64_t tick;
+    int image_fd;
+    pid_t image_pid;
+    unsigned char payload[JOURNAL_PAYLOAD_MAX];
+} journal_slot_t;
+
+// offset, last_keyframe, records and failed belong to the writer thread
+struct journal_s {
+    mpsc_ring_t ring;
+    FILE *file;
+    pthread_t writer;
+    atomic_bool running;
+    _Atomic size_t stalls;
+    uint64_t offset;
+    uint64_t last_keyframe;
+    uint64_t records;
+    bool failed;
+};
+
+// journal_ring.c: a slot stamped with the event and the current tick,
+// filled in place then published; NULL without --journal. A full ring is
+// waited on rather than dropped, a journal with a hole cannot be replayed.
+// Inside a parallel tick batch the slot is the batch's copy and the ticket
+// JOURNAL_CAPTURED, commit then leaves it to journal_publish.
+journal_slot_t *journal_begin(server_t *server, journal_event_t event,
+    size_t *ticket);
+void journal_commit(server_t *server, journal_slot_t *slot,
+    const unsigned char *end, size_t ticket);
+
+// journal_writer.c
+int journal_writer_start(journal_t *journal);
+void journal_writer_stop(journal_t *journal);
+
+// Appends the low size bytes of value, the host being little-endian
+static inline unsigned char *journal_put(unsigned char *out, uint64_t value,
+    size_t size)
+{
+    memcpy(out, &value, size);
+    return out + size;
+}
+
+#endif /* !JOURNAL_INTERNAL_H_ */
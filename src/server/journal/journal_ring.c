@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/journal/journal_ring.c
+** File description:
+** Journal records claimed and published by the game threads
+*/
+
+#include <sched.h>
+
+#include "server/tick_pool.h"
+#include "journal_internal.h"
+
+static journal_slot_t *claim(journal_t *journal, size_t *ticket)
+{
+    journal_slot_t *slot = mpsc_ring_claim(&journal->ring, ticket);
+
+    while (!slot) {
+        atomic_fetch_add_explicit(&journal->stalls, 1, memory_order_relaxed);
+        sched_yield();
+        slot = mpsc_ring_claim(&journal->ring, ticket);
+    }
+    return slot;
+}
+
+journal_slot_t *journal_begin(server_t *server, journal_event_t event,
+    size_t *ticket)
+{
+    journal_slot_t *slot;
+
+    if (!server->journal)
+        return NULL;
+    slot = tick_capture_record(sizeof(*slot));
+    if (slot)
+        *ticket = JOURNAL_CAPTURED;
+    else
+        slot = claim(server->journal, ticket);
+    slot->event = event;
+    slot->tick = server->tick_count;
+    slot->image_fd = -1;
+    slot->image_pid = 0;
+    return slot;
+}
+
+void journal_commit(server_t *server, journal_slot_t *slot,
+    const unsigned char *end, size_t ticket)
+{
+    slot->size = end - slot->payload;
+    if (ticket != JOURNAL_CAPTURED)
+        mpsc_ring_publish(&server->journal->ring, ticket);
+}
+
+void journal_publish(server_t *server, const void *record)
+{
+    size_t ticket;
+    journal_slot_t *slot = claim(server->journal, &ticket);
+
+    memcpy(slot, record, sizeof(*slot));
+    mpsc_ring_publish(&server->journal->ring, ticket);
+}
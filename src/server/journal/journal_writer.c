@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/journal/journal_writer.c
+** File description:
+** Background thread appending the journal ring to the file
+*/
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "journal_internal.h"
+#include "server/thread.h"
+
+static void write_bytes(journal_t *journal, const void *data, size_t size)
+{
+    if (size > 0 && fwrite(data, 1, size, journal->file) != size)
+        journal->failed = true;
+    journal->offset += size;
+}
+
+static void write_record(journal_t *journal, uint8_t event, uint64_t tick,
+    uint32_t size)
+{
+    size += JOURNAL_HEADER_SIZE;
+    write_bytes(journal, &size, sizeof(size));
+    write_bytes(journal, &event, sizeof(event));
+    write_bytes(journal, &tick, sizeof(tick));
+    journal->records++;
+}
+
+static bool copy_image(journal_t *journal, int fd)
+{
+    unsigned char buffer[JOURNAL_COPY_SIZE];
+    ssize_t n = read(fd, buffer, sizeof(buffer));
+
+    while (n > 0) {
+        write_bytes(journal, buffer, n);
+        n = read(fd, buffer, sizeof(buffer));
+    }
+    return n == 0;
+}
+
+static bool image_complete(pid_t pid)
+{
+    int status = 0;
+
+    return waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+        WEXITSTATUS(status) == 0;
+}
+
+// The size is only known once the child is done and is patched in place.
+// A failed image is rewound over and cut off when the journal closes.
+static void end_keyframe(journal_t *journal, uint64_t start, bool complete)
+{
+    uint32_t size = journal->offset - start - sizeof(size);
+
+    if (!complete) {
+        LOG_WARN("[JOURNAL] Keyframe at offset %llu lost",
+            (unsigned long long)start);
+        journal->offset = start;
+        journal->records--;
+    } else {
+        journal->failed |= fseeko(journal->file, start, SEEK_SET) != 0 ||
+            fwrite(&size, sizeof(size), 1, journal->file) != 1;
+        journal->last_keyframe = start;
+    }
+    if (fseeko(journal->file, journal->offset, SEEK_SET) != 0)
+        journal->failed = true;
+}
+
+// A keyframe links back to the one before, END to the last one, so a
+// reader can walk them from the end of a closed journal
+static void write_slot(journal_t *journal, journal_slot_t *slot)
+{
+    uint64_t start = journal->offset;
+    bool copied;
+
+    if (slot->event == JOURNAL_END)
+        slot->size = journal_put(slot->payload, journal->last_keyframe,
+            sizeof(journal->last_keyframe)) - slot->payload;
+    if (slot->event != JOURNAL_KEYFRAME) {
+        write_record(journal, slot->event, slot->tick, slot->size);
+        return write_bytes(journal, slot->payload, slot->size);
+    }
+    write_record(journal, slot->event, slot->tick, 0);
+    write_bytes(journal, &journal->last_keyframe,
+        sizeof(journal->last_keyframe));
+    copied = copy_image(journal, slot->image_fd);
+    close(slot->image_fd);
+    end_keyframe(journal, start, image_complete(slot->image_pid) && copied);
+}
+
+static size_t drain_ring(journal_t *journal)
+{
+    journal_slot_t *slot = mpsc_ring_peek(&journal->ring);
+    size_t written = 0;
+
+    while (slot) {
+        write_slot(journal, slot);
+        mpsc_ring_release(&journal->ring);
+        written++;
+        slot = mpsc_ring_peek(&journal->ring);
+    }
+    return written;
+}
+
+static void *writer_thread(void *arg)
+{
+    journal_t *journal = arg;
+    struct timespec idle = {0, 1000000};
+
+    while (atomic_load_explicit(&journal->running, memory_order_acquire)) {
+        if (drain_ring(journal) > 0)
+            continue;
+        if (fflush(journal->file) != 0)
+            journal->failed = true;
+        nanosleep(&idle, NULL);
+    }
+    drain_ring(journal);
+    return NULL;
+}
+
+int journal_writer_start(journal_t *journal)
+{
+    atomic_store(&journal->running, true);
+    if (thread_spawn_unsignaled(&journal->writer, writer_thread,
+        journal) == 0)
+        return 0;
+    atomic_store(&journal->running, false);
+    return -1;
+}
+
+void journal_writer_stop(journal_t *journal)
+{
+    if (!atomic_load(&journal->running))
+        return;
+    atomic_store_explicit(&journal->running, false, memory_order_release);
+    pthread_join(journal->writer, NULL);
+}
@@ -11,7 +11,10 @@
 
 #include "server/lifecycle.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
 #include "server/payloads.h"
+#include "server/team.h"
+#include "server/map.h"
 
 void consume_food(client_t *client)
 {
@@ -29,23 +32,48 @@ void consume_food(client_t *client)
     }
 }
 
+bool player_digest(player_t *player)
+{
+    player->last_food_inhalation += 1;
+    if (player->last_food_inhalation < FOOD_INHALATION_TIME)
+        return false;
+    player->resources[RESOURCE_FOOD]--;
+    player->last_food_inhalation = 0;
+    return player->resources[RESOURCE_FOOD] <= 0;
+}
+
+// The body leaves the occupant list at once, so eject and incantation
+// never see it while the client waits for check_for_death. Food can be
+// at -1 when the last one was Set down, and must not become a negative
+// stack on the tile (Look sizes its reply from the counts).
+static void drop_body(server_t *server, player_t *player)
+{
+    tile_id_t tile = map_tile_at(server->game->map, player->x, player->y);
+
+    assert(tile != TILE_NONE);
+    player_remove_from_tile(server->game->map, player);
+    for (int i = 0; i < RESOURCE_COUNT; i++) {
+        if (player->resources[i] > 0)
+            map_add_resource(server->game->map, tile, i,
+                player->resources[i]);
+        player->resources[i] = 0;
+    }
+    map_mark_dirty(server->game->map, tile);
+}
+
 void player_die(client_t *client, server_t *server)
 {
     player_t *player = client ? client->player : NULL;
-    tile_t *tile = NULL;
 
     if (!client || !player)
         return;
+    if (server && server->game && player->is_alive)
+        team_track_player(server->game, player, -1);
     player->is_alive = false;
     if (server && server->game) {
         broadcast_player_death(server, player);
-        tile = map_get_tile(server->game->map, player->x, player->y);
-        assert(tile != NULL);
-        for (int i = 0; i < RESOURCE_COUNT; i++) {
-            tile->resources[i] += player->resources[i];
-            player->resources[i] = 0;
-        }
-        broadcast_tile_to_guis(server, player->x, player->y);
+        journal_player(server, JOURNAL_PDI, player);
+        drop_body(server, player);
     }
     send_response(client, "dead\n");
 }
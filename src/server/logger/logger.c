@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/logger/logger.c
+** File description:
+** Leveled logger producers and level parsing
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "server/logger.h"
+#include "logger_internal.h"
+
+log_level_t g_log_level = LOG_LEVEL_INFO;
+
+static const char *const log_level_names[] = {
+    [LOG_LEVEL_DEBUG] = "debug",
+    [LOG_LEVEL_INFO] = "info",
+    [LOG_LEVEL_WARN] = "warn",
+    [LOG_LEVEL_ERROR] = "error",
+    [LOG_LEVEL_NONE] = "none",
+};
+
+static void format_entry(log_entry_t *entry, log_level_t level,
+    const char *fmt, va_list args)
+{
+    int len = vsnprintf(entry->text, sizeof(entry->text), fmt, args);
+
+    entry->level = level;
+    if (len < 0)
+        len = 0;
+    if ((size_t)len >= sizeof(entry->text) - 1)
+        len = sizeof(entry->text) - 2;
+    if (len == 0 || entry->text[len - 1] != '\n') {
+        entry->text[len] = '\n';
+        entry->text[len + 1] = '\0';
+    }
+}
+
+static void write_sync(log_level_t level, const char *fmt, va_list args)
+{
+    log_entry_t entry;
+
+    format_entry(&entry, level, fmt, args);
+    fputs(entry.text, log_stream(level));
+}
+
+int log_write(log_level_t level, const char *fmt, ...)
+{
+    logger_t *logger = get_logger();
+    log_entry_t *entry;
+    size_t ticket;
+    va_list args;
+
+    va_start(args, fmt);
+    if (!atomic_load_explicit(&logger->running, memory_order_acquire)) {
+        write_sync(level, fmt, args);
+        va_end(args);
+        return 0;
+    }
+    entry = mpsc_ring_claim(&logger->ring, &ticket);
+    if (entry) {
+        format_entry(entry, level, fmt, args);
+        mpsc_ring_publish(&logger->ring, ticket);
+    } else {
+        atomic_fetch_add_explicit(&logger->dropped, 1, memory_order_relaxed);
+    }
+    va_end(args);
+    return 0;
+}
+
+int log_level_from_string(const char *name, log_level_t *level)
+{
+    if (!name || !level)
+        return -1;
+    for (int i = LOG_LEVEL_DEBUG; i <= LOG_LEVEL_NONE; ++i) {
+        if (strcmp(name, log_level_names[i]) == 0) {
+            *level = (log_level_t)i;
+            return 0;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/logger/logger_internal.h
+** File description:
+** State shared by the logger producers and its writer thread
+*/
+
+#ifndef LOGGER_INTERNAL_H_
+    #define LOGGER_INTERNAL_H_
+
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdio.h>
+
+    #include "server/logger.h"
+    #include "server/mpsc_ring.h"
+
+typedef struct log_entry_s {
+    log_level_t level;
+    char text[LOG_MESSAGE_SIZE];
+} log_entry_t;
+
+typedef struct logger_s {
+    mpsc_ring_t ring;
+    pthread_t writer;
+    atomic_bool running;
+    _Atomic size_t dropped;
+} logger_t;
+
+// Single process-wide instance, defined in logger_writer.c
+logger_t *get_logger(void);
+
+static inline FILE *log_stream(log_level_t level)
+{
+    return level >= LOG_LEVEL_WARN ? stderr : stdout;
+}
+
+#endif /* !LOGGER_INTERNAL_H_ */
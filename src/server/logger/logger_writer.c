@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/logger/logger_writer.c
+** File description:
+** Background thread draining the logger ring to the output streams
+*/
+
+#include <time.h>
+
+#include "logger_internal.h"
+#include "server/thread.h"
+
+logger_t *get_logger(void)
+{
+    static logger_t logger = {0};
+
+    return &logger;
+}
+
+static size_t drain_ring(logger_t *logger)
+{
+    log_entry_t *entry = mpsc_ring_peek(&logger->ring);
+    size_t written = 0;
+
+    while (entry) {
+        fputs(entry->text, log_stream(entry->level));
+        mpsc_ring_release(&logger->ring);
+        written++;
+        entry = mpsc_ring_peek(&logger->ring);
+    }
+    return written;
+}
+
+static void report_dropped(logger_t *logger)
+{
+    size_t dropped = atomic_exchange(&logger->dropped, 0);
+
+    if (dropped > 0)
+        fprintf(stderr, "[LOG] %zu messages dropped\n", dropped);
+}
+
+static void *writer_thread(void *arg)
+{
+    logger_t *logger = arg;
+    struct timespec idle = {0, 1000000};
+
+    while (atomic_load_explicit(&logger->running, memory_order_acquire)) {
+        if (drain_ring(logger) > 0)
+            continue;
+        fflush(stdout);
+        report_dropped(logger);
+        nanosleep(&idle, NULL);
+    }
+    drain_ring(logger);
+    report_dropped(logger);
+    fflush(stdout);
+    return NULL;
+}
+
+static int spawn_writer(logger_t *logger)
+{
+    return thread_spawn_unsignaled(&logger->writer, writer_thread, logger);
+}
+
+int log_init(log_level_t level)
+{
+    logger_t *logger = get_logger();
+
+    g_log_level = level;
+    if (atomic_load(&logger->running))
+        return 0;
+    if (mpsc_ring_init(&logger->ring, LOG_RING_SLOTS,
+        sizeof(log_entry_t)) == -1)
+        return -1;
+    atomic_store(&logger->running, true);
+    if (spawn_writer(logger) == -1) {
+        atomic_store(&logger->running, false);
+        mpsc_ring_destroy(&logger->ring);
+        return -1;
+    }
+    return 0;
+}
+
+void log_shutdown(void)
+{
+    logger_t *logger = get_logger();
+
+    if (!atomic_load(&logger->running))
+        return;
+    atomic_store_explicit(&logger->running, false, memory_order_release);
+    pthread_join(logger->writer, NULL);
+    mpsc_ring_destroy(&logger->ring);
+}
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/logger/mpsc_ring.c
+** File description:
+** Bounded lock-free multi-producer single-consumer ring of fixed slots
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "server/mpsc_ring.h"
+
+static _Atomic size_t *cell_sequence(mpsc_ring_t *ring, size_t pos)
+{
+    return (_Atomic size_t *)(ring->cells +
+        (pos & ring->mask) * ring->cell_size);
+}
+
+int mpsc_ring_init(mpsc_ring_t *ring, size_t slot_count, size_t slot_size)
+{
+    if (!ring || slot_count == 0 || (slot_count & (slot_count - 1)) != 0)
+        return -1;
+    ring->slot_size = slot_size;
+    ring->cell_size = (sizeof(size_t) + slot_size + 15) & ~(size_t)15;
+    ring->mask = slot_count - 1;
+    ring->cells = malloc(ring->cell_size * slot_count);
+    if (!ring->cells)
+        return -1;
+    for (size_t i = 0; i < slot_count; ++i)
+        atomic_init(cell_sequence(ring, i), i);
+    atomic_init(&ring->enqueue_pos, 0);
+    atomic_init(&ring->dequeue_pos, 0);
+    return 0;
+}
+
+void mpsc_ring_destroy(mpsc_ring_t *ring)
+{
+    if (!ring)
+        return;
+    free(ring->cells);
+    ring->cells = NULL;
+}
+
+void *mpsc_ring_claim(mpsc_ring_t *ring, size_t *ticket)
+{
+    size_t pos = atomic_load_explicit(&ring->enqueue_pos,
+        memory_order_relaxed);
+    intptr_t diff;
+
+    while (1) {
+        diff = (intptr_t)atomic_load_explicit(cell_sequence(ring, pos),
+            memory_order_acquire) - (intptr_t)pos;
+        if (diff < 0)
+            return NULL;
+        if (diff == 0 && atomic_compare_exchange_weak_explicit(
+            &ring->enqueue_pos, &pos, pos + 1,
+            memory_order_relaxed, memory_order_relaxed))
+            break;
+        if (diff > 0)
+            pos = atomic_load_explicit(&ring->enqueue_pos,
+                memory_order_relaxed);
+    }
+    *ticket = pos;
+    return (unsigned char *)cell_sequence(ring, pos) + sizeof(size_t);
+}
+
+void mpsc_ring_publish(mpsc_ring_t *ring, size_t ticket)
+{
+    atomic_store_explicit(cell_sequence(ring, ticket), ticket + 1,
+        memory_order_release);
+}
+
+void *mpsc_ring_peek(mpsc_ring_t *ring)
+{
+    size_t pos = atomic_load_explicit(&ring->dequeue_pos,
+        memory_order_relaxed);
+    size_t seq = atomic_load_explicit(cell_sequence(ring, pos),
+        memory_order_acquire);
+
+    if (seq != pos + 1)
+        return NULL;
+    return (unsigned char *)cell_sequence(ring, pos) + sizeof(size_t);
+}
+
+void mpsc_ring_release(mpsc_ring_t *ring)
+{
+    size_t pos = atomic_load_explicit(&ring->dequeue_pos,
+        memory_order_relaxed);
+
+    atomic_store_explicit(cell_sequence(ring, pos), pos + ring->mask + 1,
+        memory_order_release);
+    atomic_store_explicit(&ring->dequeue_pos, pos + 1,
+        memory_order_relaxed);
+}
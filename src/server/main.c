@@ -6,10 +6,28 @@
 */
 
 #include "server/server.h"
+#include "server/host.h"
 #include "shared/utils.h"
 #include <stdio.h>
 #include <string.h>
 
+static void print_options(void)
+{
+    printf("  --log-level l  : debug, info, warn, error or none\n");
+    printf("  --io-threads n : socket I/O on n threads (0: main loop)\n");
+    printf("  --tick-threads n : run ticks on n threads (0, 1: serial)\n");
+    printf("  --games n      : host n games, clients pick one in a lobby\n");
+    printf("  --unix path    : also listen on a unix socket\n");
+    printf("  --snapshot f   : save the game to f at exit\n");
+    printf("  --snapshot-every n : also save it every n ticks\n");
+    printf("  --restore f    : start from the game saved in f\n");
+    printf("  --journal f    : record every game event to f\n");
+    printf("  --keyframe-every n : full state in the journal every n ticks\n");
+    printf("  --admin path   : serve performance metrics on a unix socket\n");
+    printf("  --seed n       : random seed (default: current time)\n");
+    printf("  --turbo        : run ticks as soon as every player waits\n");
+}
+
 static void print_help(const char *program_name)
 {
     printf("USAGE: %s -p port -x width -y height -n name1 name2 "
@@ -22,6 +40,7 @@ static void print_help(const char *program_name)
     printf("  -f freq        : reciprocal "
         "of time unit for execution of actions\n");
     printf("  -r <bool>      : refill tiles with resources\n");
+    print_options();
 }
 
 static int handle_arguments(int argc, const char **argv,
@@ -39,16 +58,34 @@ static int handle_arguments(int argc, const char **argv,
     return -1;
 }
 
+static int run_host(const server_config_t *config)
+{
+    int ret = host_run(config);
+
+    log_shutdown();
+    if (ret == -1) {
+        fprintf(stderr, "Error: Failed to start the games\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
 static int create_and_run_server(const server_config_t *config)
 {
     server_t server = {0};
 
+    if (log_init(config->log_level) == -1)
+        fprintf(stderr, "Warning: logging falls back to synchronous\n");
+    if (config->games > 1)
+        return run_host(config);
     if (server_create(&server, config) == -1) {
+        log_shutdown();
         fprintf(stderr, "Error: Failed to create server\n");
         return FAILURE;
     }
     server_run(&server);
     server_destroy(&server);
+    log_shutdown();
     return SUCCESS;
 }
 
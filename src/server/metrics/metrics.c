@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics.c
+** File description:
+** Metrics lifecycle and traffic totals
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "metrics_internal.h"
+
+static const char *const type_names[] = {
+    [CLIENT_TYPE_UNKNOWN] = "unknown",
+    [CLIENT_TYPE_AI] = "ai",
+    [CLIENT_TYPE_GRAPHIC] = "gui",
+};
+
+int metrics_open(server_t *server)
+{
+    metrics_t *metrics;
+
+    if (server->admin_fd == -1)
+        return 0;
+    metrics = calloc(1, sizeof(*metrics));
+    if (!metrics) {
+        LOG_ERROR("[METRICS] Cannot allocate the counters");
+        return -1;
+    }
+    metrics->pending_fd = -1;
+    metrics->started_ns = metrics_clock();
+    metrics->last_ns = metrics->started_ns;
+    server->metrics = metrics;
+    return 0;
+}
+
+void metrics_close(server_t *server)
+{
+    metrics_t *metrics = server->metrics;
+
+    if (!metrics)
+        return;
+    if (metrics->pending_fd != -1)
+        close(metrics->pending_fd);
+    free(metrics->dump);
+    LOG_INFO("[METRICS] %llu admin queries served",
+        (unsigned long long)metrics->queries);
+    free(metrics);
+    server->metrics = NULL;
+}
+
+void metrics_retire(server_t *server, const client_t *client)
+{
+    traffic_t *retired;
+
+    if (!server->metrics)
+        return;
+    retired = &server->metrics->retired;
+    retired->messages_in += client->traffic.messages_in;
+    retired->bytes_in += client->traffic.bytes_in;
+    retired->messages_out += client->traffic.messages_out;
+    retired->bytes_out += client->traffic.bytes_out;
+}
+
+const char *metrics_client_type(const client_t *client)
+{
+    return type_names[client->type];
+}
@@ -0,0 +1,156 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics_admin.c
+** File description:
+** Admin socket queries answered between two polls
+*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/sockios.h>
+
+#include "metrics_internal.h"
+
+int metrics_backlog(const client_t *client)
+{
+    int queued = 0;
+
+    if (ioctl(client->fd, SIOCOUTQ, &queued) == -1)
+        return 0;
+    return queued;
+}
+
+// Only summed when someone asks, the hot path just bumps the client's own
+static traffic_t sum_traffic(const server_t *server)
+{
+    traffic_t total = server->metrics->retired;
+    const traffic_t *one;
+
+    for (size_t i = 0; i < server->client_count; ++i) {
+        one = &server->clients[i]->traffic;
+        total.messages_in += one->messages_in;
+        total.bytes_in += one->bytes_in;
+        total.messages_out += one->messages_out;
+        total.bytes_out += one->bytes_out;
+    }
+    return total;
+}
+
+static size_t count_queued(const server_t *server)
+{
+    size_t queued = 0;
+
+    for (size_t i = 0; i < server->client_count; ++i)
+        queued += server->clients[i]->action_queue_count;
+    return queued;
+}
+
+static void finish(metrics_t *metrics)
+{
+    close(metrics->pending_fd);
+    metrics->pending_fd = -1;
+    free(metrics->dump);
+    metrics->dump = NULL;
+}
+
+// Sends what the socket takes without waiting, the rest goes on POLLOUT
+static void flush_dump(metrics_t *metrics)
+{
+    ssize_t sent = 1;
+
+    while (metrics->dump_sent < metrics->dump_size && sent > 0) {
+        sent = send(metrics->pending_fd, metrics->dump + metrics->dump_sent,
+            metrics->dump_size - metrics->dump_sent,
+            MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent > 0) {
+            metrics->dump_sent += sent;
+            metrics->pending_ns = metrics_clock();
+        }
+    }
+    if (metrics->dump_sent == metrics->dump_size ||
+        (sent == -1 && errno != EAGAIN && errno != EWOULDBLOCK))
+        finish(metrics);
+}
+
+static void serve(server_t *server, bool json)
+{
+    metrics_t *metrics = server->metrics;
+    uint64_t now = metrics_clock();
+    metrics_view_t view = {server, metrics, sum_traffic(server),
+        count_queued(server), (now - metrics->started_ns) / 1e9,
+        (now - metrics->last_ns) / 1e9};
+    FILE *out = open_memstream(&metrics->dump, &metrics->dump_size);
+
+    metrics->dump_sent = 0;
+    if (!out)
+        return finish(metrics);
+    (json ? metrics_write_json : metrics_write_text)(out, &view);
+    if (fclose(out) != 0)
+        return finish(metrics);
+    metrics->last = view.total;
+    metrics->last_ns = now;
+    metrics->queries++;
+    metrics->pending_ns = now;
+    flush_dump(metrics);
+}
+
+// Anything but a request starting with "json" gets the text dump, as does
+// a client that hangs up without one
+static bool wants_json(int fd)
+{
+    char request[METRICS_REQUEST_SIZE];
+    ssize_t received = recv(fd, request, sizeof(request) - 1, MSG_DONTWAIT);
+
+    if (received <= 0)
+        return false;
+    request[received] = '\0';
+    return strncmp(request, "json", 4) == 0;
+}
+
+// A silent client is answered in text once METRICS_ADMIN_TIMEOUT_MS ran
+// out, a reader that took nothing for as long is dropped. Until the
+// connection is done the listener is not polled and others wait in its
+// queue.
+struct pollfd metrics_admin_pollfd(server_t *server)
+{
+    metrics_t *metrics = server->metrics;
+    bool late;
+
+    if (!metrics || metrics->pending_fd == -1)
+        return (struct pollfd){server->admin_fd, POLLIN, 0};
+    late = metrics_clock() - metrics->pending_ns >
+        METRICS_ADMIN_TIMEOUT_MS * 1000000ULL;
+    if (late && metrics->dump) {
+        LOG_WARN("[METRICS] Admin reader stalled, dump dropped");
+        finish(metrics);
+    } else if (late) {
+        serve(server, false);
+    }
+    if (metrics->pending_fd == -1)
+        return (struct pollfd){server->admin_fd, POLLIN, 0};
+    return (struct pollfd){metrics->pending_fd,
+        metrics->dump ? POLLOUT : POLLIN, 0};
+}
+
+bool metrics_admin_handle(server_t *server, struct pollfd *pfd)
+{
+    metrics_t *metrics = server->metrics;
+
+    if (!metrics || pfd->fd == -1 || !(pfd->revents & METRICS_ADMIN_EVENTS))
+        return false;
+    pfd->revents = 0;
+    if (pfd->fd == metrics->pending_fd && metrics->dump) {
+        flush_dump(metrics);
+    } else if (pfd->fd == metrics->pending_fd) {
+        serve(server, wants_json(pfd->fd));
+    } else {
+        metrics->pending_fd = accept4(pfd->fd, NULL, NULL,
+            SOCK_NONBLOCK | SOCK_CLOEXEC);
+        metrics->pending_ns = metrics_clock();
+    }
+    return true;
+}
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics_internal.h
+** File description:
+** Counters kept by the game thread and the dumps built from them
+*/
+
+#ifndef METRICS_INTERNAL_H_
+    #define METRICS_INTERNAL_H_
+
+    #include <stdio.h>
+
+    #include "server/metrics.h"
+
+typedef struct metrics_timer_s {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t buckets[METRICS_BUCKETS];
+} metrics_timer_t;
+
+// retired holds the traffic of the clients already gone. Rates are taken
+// over the time since the previous query, from last and last_ns. The
+// connection being answered is pending_fd; dump, once built, is sent from
+// dump_sent on, and pending_ns is when it last made progress.
+struct metrics_s {
+    metrics_timer_t timers[METRICS_PHASES];
+    uint64_t started_ns;
+    traffic_t retired;
+    traffic_t last;
+    uint64_t last_ns;
+    uint64_t queries;
+    int pending_fd;
+    uint64_t pending_ns;
+    char *dump;
+    size_t dump_size;
+    size_t dump_sent;
+};
+
+// What one query reports, gathered once for either format. queued sums
+// the action queues of the clients.
+typedef struct metrics_view_s {
+    const server_t *server;
+    const metrics_t *metrics;
+    traffic_t total;
+    size_t queued;
+    double uptime;
+    double interval;
+} metrics_view_t;
+
+// metrics.c, metrics_timer.c
+const char *metrics_client_type(const client_t *client);
+uint64_t metrics_clock(void);
+const char *metrics_phase_name(metrics_phase_t phase);
+
+// metrics_admin.c: bytes still in the client's socket send queue
+int metrics_backlog(const client_t *client);
+
+// metrics_text.c, metrics_json.c
+void metrics_write_text(FILE *out, const metrics_view_t *view);
+void metrics_write_json(FILE *out, const metrics_view_t *view);
+
+// Per second over the view's interval
+static inline double metrics_rate(const metrics_view_t *view,
+    uint64_t now, uint64_t before)
+{
+    return view->interval > 0.0 ? (double)(now - before) / view->interval :
+        0.0;
+}
+
+#endif /* !METRICS_INTERNAL_H_ */
@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics_json.c
+** File description:
+** JSON dump of the metrics, one object per query
+*/
+
+#include "server/io_pool.h"
+#include "metrics_internal.h"
+
+// Team names come from the command line and may need escaping
+static void write_string(FILE *out, const char *text)
+{
+    if (!text) {
+        fputs("null", out);
+        return;
+    }
+    fputc('"', out);
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\')
+            fprintf(out, "\\%c", *text);
+        else if ((unsigned char)*text < 0x20)
+            fprintf(out, "\\u%04x", *text);
+        else
+            fputc(*text, out);
+    }
+    fputc('"', out);
+}
+
+static void write_timer(FILE *out, const metrics_timer_t *timer,
+    metrics_phase_t phase)
+{
+    fprintf(out, "%s\"%s\":{\"count\":%llu,\"total_ns\":%llu,"
+        "\"max_ns\":%llu,\"histogram_us_log2\":[", phase ? "," : "",
+        metrics_phase_name(phase), (unsigned long long)timer->count,
+        (unsigned long long)timer->total_ns,
+        (unsigned long long)timer->max_ns);
+    for (int b = 0; b < METRICS_BUCKETS; ++b)
+        fprintf(out, "%s%llu", b ? "," : "",
+            (unsigned long long)timer->buckets[b]);
+    fputs("]}", out);
+}
+
+static void write_traffic(FILE *out, const metrics_view_t *view)
+{
+    const traffic_t *now = &view->total;
+    const traffic_t *last = &view->metrics->last;
+
+    fprintf(out, "\"traffic\":{\"messages_in\":%llu,\"bytes_in\":%llu,"
+        "\"messages_out\":%llu,\"bytes_out\":%llu,"
+        "\"messages_in_per_s\":%.1f,\"bytes_in_per_s\":%.1f,"
+        "\"messages_out_per_s\":%.1f,\"bytes_out_per_s\":%.1f},",
+        (unsigned long long)now->messages_in,
+        (unsigned long long)now->bytes_in,
+        (unsigned long long)now->messages_out,
+        (unsigned long long)now->bytes_out,
+        metrics_rate(view, now->messages_in, last->messages_in),
+        metrics_rate(view, now->bytes_in, last->bytes_in),
+        metrics_rate(view, now->messages_out, last->messages_out),
+        metrics_rate(view, now->bytes_out, last->bytes_out));
+}
+
+static void write_client(FILE *out, const client_t *client, bool first)
+{
+    fprintf(out, "%s{\"fd\":%d,\"type\":\"%s\",\"team\":", first ? "" : ",",
+        client->fd, metrics_client_type(client));
+    write_string(out, client->team_name);
+    fprintf(out, ",\"player\":%d,\"queue\":%zu,\"backlog\":%d,"
+        "\"messages_in\":%llu,\"bytes_in\":%llu,"
+        "\"messages_out\":%llu,\"bytes_out\":%llu}",
+        client->player ? client->player->id : -1,
+        client->action_queue_count, metrics_backlog(client),
+        (unsigned long long)client->traffic.messages_in,
+        (unsigned long long)client->traffic.bytes_in,
+        (unsigned long long)client->traffic.messages_out,
+        (unsigned long long)client->traffic.bytes_out);
+}
+
+static void write_io(FILE *out, const server_t *server)
+{
+    if (!server->io) {
+        fputs("\"io\":null", out);
+        return;
+    }
+    fprintf(out, "\"io\":{\"inbound\":%zu,\"outbound\":[",
+        io_pool_inbound_depth(server));
+    for (size_t i = 0; i < server->config.io_threads; ++i)
+        fprintf(out, "%s%zu", i ? "," : "",
+            io_pool_outbound_depth(server, i));
+    fputs("]}", out);
+}
+
+void metrics_write_json(FILE *out, const metrics_view_t *view)
+{
+    const server_t *server = view->server;
+
+    fprintf(out, "{\"uptime_s\":%.3f,\"interval_s\":%.3f,\"tick\":%llu,",
+        view->uptime, view->interval,
+        (unsigned long long)server->tick_count);
+    write_traffic(out, view);
+    fputs("\"timers\":{", out);
+    for (int phase = 0; phase < METRICS_PHASES; ++phase)
+        write_timer(out, &view->metrics->timers[phase], phase);
+    fprintf(out, "},\"actions_queued\":%zu,\"clients\":[", view->queued);
+    for (size_t i = 0; i < server->client_count; ++i)
+        write_client(out, server->clients[i], i == 0);
+    fputs("],", out);
+    write_io(out, server);
+    fputs("}\n", out);
+}
@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics_text.c
+** File description:
+** Human readable dump of the metrics
+*/
+
+#include "server/io_pool.h"
+#include "metrics_internal.h"
+
+// Upper bound of the bucket holding the q-th fraction of the samples
+static uint64_t percentile_us(const metrics_timer_t *timer, double q)
+{
+    uint64_t rank = (uint64_t)(q * (double)timer->count);
+    uint64_t seen = 0;
+    int bucket = 0;
+
+    while (bucket < METRICS_BUCKETS - 1) {
+        seen += timer->buckets[bucket];
+        if (seen > rank)
+            break;
+        bucket++;
+    }
+    return 1ULL << bucket;
+}
+
+static void write_timer(FILE *out, const metrics_view_t *view,
+    metrics_phase_t phase)
+{
+    const metrics_timer_t *timer = &view->metrics->timers[phase];
+
+    fprintf(out, "%-8s %10llu %10.1f %10.1f %8llu %8llu ",
+        metrics_phase_name(phase), (unsigned long long)timer->count,
+        timer->count ? timer->total_ns / 1e3 / timer->count : 0.0,
+        timer->max_ns / 1e3,
+        (unsigned long long)percentile_us(timer, 0.5),
+        (unsigned long long)percentile_us(timer, 0.99));
+    for (int b = 0; b < METRICS_BUCKETS; ++b) {
+        if (timer->buckets[b])
+            fprintf(out, " <%lluus:%llu", 1ULL << b,
+                (unsigned long long)timer->buckets[b]);
+    }
+    fputc('\n', out);
+}
+
+static void write_traffic(FILE *out, const metrics_view_t *view)
+{
+    const traffic_t *now = &view->total;
+    const traffic_t *last = &view->metrics->last;
+
+    fprintf(out, "in  %llu messages (%.1f/s) %llu bytes (%.1f/s)\n",
+        (unsigned long long)now->messages_in,
+        metrics_rate(view, now->messages_in, last->messages_in),
+        (unsigned long long)now->bytes_in,
+        metrics_rate(view, now->bytes_in, last->bytes_in));
+    fprintf(out, "out %llu messages (%.1f/s) %llu bytes (%.1f/s)\n",
+        (unsigned long long)now->messages_out,
+        metrics_rate(view, now->messages_out, last->messages_out),
+        (unsigned long long)now->bytes_out,
+        metrics_rate(view, now->bytes_out, last->bytes_out));
+}
+
+static void write_clients(FILE *out, const metrics_view_t *view)
+{
+    const server_t *server = view->server;
+    const client_t *client;
+
+    fprintf(out, "clients %zu, actions queued %zu\n",
+        server->client_count, view->queued);
+    for (size_t i = 0; i < server->client_count; ++i) {
+        client = server->clients[i];
+        fprintf(out, "  fd %d %s %s player %d queue %zu backlog %d"
+            " in %llu/%lluB out %llu/%lluB\n", client->fd,
+            metrics_client_type(client),
+            client->team_name ? client->team_name : "-",
+            client->player ? client->player->id : -1,
+            client->action_queue_count, metrics_backlog(client),
+            (unsigned long long)client->traffic.messages_in,
+            (unsigned long long)client->traffic.bytes_in,
+            (unsigned long long)client->traffic.messages_out,
+            (unsigned long long)client->traffic.bytes_out);
+    }
+}
+
+static void write_io(FILE *out, const server_t *server)
+{
+    if (!server->io)
+        return;
+    fprintf(out, "io inbound %zu, outbound", io_pool_inbound_depth(server));
+    for (size_t i = 0; i < server->config.io_threads; ++i)
+        fprintf(out, " %zu", io_pool_outbound_depth(server, i));
+    fputc('\n', out);
+}
+
+void metrics_write_text(FILE *out, const metrics_view_t *view)
+{
+    fprintf(out, "uptime %.3fs, tick %llu, %.3fs since the last query\n",
+        view->uptime, (unsigned long long)view->server->tick_count,
+        view->interval);
+    write_traffic(out, view);
+    fprintf(out, "%-8s %10s %10s %10s %8s %8s  histogram\n", "timer",
+        "count", "mean_us", "max_us", "p50_us", "p99_us");
+    for (int phase = 0; phase < METRICS_PHASES; ++phase)
+        write_timer(out, view, phase);
+    write_clients(out, view);
+    write_io(out, view->server);
+}
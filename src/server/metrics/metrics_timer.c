@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/metrics/metrics_timer.c
+** File description:
+** Phase timers and their log2 histograms
+*/
+
+#include <time.h>
+
+#include "metrics_internal.h"
+
+static const char *const phase_names[METRICS_PHASES] = {
+    [METRICS_TICK] = "tick",
+    [METRICS_POLL] = "poll",
+    [METRICS_ACTIONS] = "actions",
+    [METRICS_RESPAWN] = "respawn",
+    [METRICS_FOOD] = "food",
+    [METRICS_TILES] = "tiles",
+    [METRICS_WIN] = "win",
+};
+
+uint64_t metrics_clock(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+const char *metrics_phase_name(metrics_phase_t phase)
+{
+    return phase_names[phase];
+}
+
+uint64_t metrics_start(const server_t *server)
+{
+    return server->metrics ? metrics_clock() : 0;
+}
+
+static void record(metrics_timer_t *timer, uint64_t elapsed)
+{
+    uint64_t us = elapsed / 1000;
+    int bucket = us ? 64 - __builtin_clzll(us) : 0;
+
+    if (bucket >= METRICS_BUCKETS)
+        bucket = METRICS_BUCKETS - 1;
+    timer->buckets[bucket]++;
+    timer->count++;
+    timer->total_ns += elapsed;
+    if (elapsed > timer->max_ns)
+        timer->max_ns = elapsed;
+}
+
+uint64_t metrics_lap(server_t *server, metrics_phase_t phase,
+    uint64_t started)
+{
+    uint64_t now;
+
+    if (!server->metrics)
+        return 0;
+    now = metrics_clock();
+    record(&server->metrics->timers[phase], now - started);
+    return now;
+}
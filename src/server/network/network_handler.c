@@ -12,72 +12,80 @@
 #include <string.h>
 
 #include "server/server.h"
+#include "server/host.h"
 
-static void handle_new_connection(server_t *server)
+static int accept_one_connection(server_t *server, int listen_fd)
 {
-    struct sockaddr_in client_addr;
+    struct sockaddr_storage client_addr;
     socklen_t addr_len = sizeof(client_addr);
-    int client_fd = accept(server->server_fd,
+    int client_fd = accept(listen_fd,
         (struct sockaddr *)&client_addr, &addr_len);
 
     if (client_fd == -1) {
-        printf("[SERVER] Accept failed: %s\n", strerror(errno));
-        return;
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            LOG_WARN("[SERVER] Accept failed: %s", strerror(errno));
+        return -1;
     }
     if (client_add(server, client_fd) == -1) {
-        printf("[SERVER] Failed to add client\n");
+        LOG_WARN("[SERVER] Failed to add client");
         close(client_fd);
     }
+    return 0;
+}
+
+// A hosted game's only listener is the host's hand-off queue. The admin
+// socket is polled among the listeners, but metrics_admin_handle has
+// already taken its events.
+void network_accept_connections(server_t *server, int listen_fd)
+{
+    if (server->host) {
+        host_game_adopt(server);
+        return;
+    }
+    while (accept_one_connection(server, listen_fd) == 0);
 }
 
 static bool should_remove_client(struct pollfd *pfd)
 {
     if (pfd->revents & (POLLHUP | POLLERR | POLLNVAL)) {
-        printf("[SERVER] Client fd:%d has error condition (revents: %d)\n",
+        LOG_INFO("[SERVER] Client fd:%d has error condition (revents: %d)",
             pfd->fd, pfd->revents);
         return true;
     }
     return false;
 }
 
-static void handle_client_input(server_t *server, client_t *client)
-{
-    client_handle_message(server, client);
-    client = client_find_by_fd(server, client->fd);
-}
-
 static void handle_client_event(server_t *server, size_t poll_index)
 {
     struct pollfd *pfd = &server->poll_fds[poll_index];
-    client_t *client = client_find_by_fd(server, pfd->fd);
-    bool should_remove = false;
-    size_t client_index;
+    client_t *client = server->clients[poll_index - server->listener_count];
 
-    if (!client)
-        return;
     if (should_remove_client(pfd)) {
-        should_remove = true;
-    }
-    if (pfd->revents & POLLIN && !should_remove_client(pfd)) {
-        handle_client_input(server, client);
-        if (!client_find_by_fd(server, pfd->fd))
-            should_remove = false;
-    }
-    if (should_remove) {
-        client_index = client - server->clients;
-        client_remove(server, client_index);
+        client_remove(server, client);
+        return;
     }
+    if (pfd->revents & POLLIN)
+        client_handle_message(server, client);
 }
 
+// A removal swaps the last client into the current index, which then
+// still has to be looked at
 static void process_ready_events(server_t *server, int ready_count)
 {
-    size_t i;
+    size_t first = server->listener_count;
+    size_t i = first;
+    client_t *client;
 
-    for (i = 1; i < server->poll_count && ready_count > 0; i++) {
-        if (server->poll_fds[i].revents != 0) {
-            handle_client_event(server, i);
-            ready_count--;
+    while (i < server->poll_count && ready_count > 0) {
+        if (server->poll_fds[i].revents == 0) {
+            i++;
+            continue;
         }
+        client = server->clients[i - first];
+        handle_client_event(server, i);
+        ready_count--;
+        if (i < server->poll_count && server->clients[i - first] == client)
+            i++;
     }
 }
 
@@ -85,9 +93,11 @@ void network_handle_events(server_t *server, int ready_count)
 {
     if (!server)
         return;
-    if (server->poll_fds[0].revents & POLLIN) {
-        handle_new_connection(server);
-        ready_count--;
+    for (size_t i = 0; i < server->listener_count; ++i) {
+        if (server->poll_fds[i].revents & POLLIN) {
+            network_accept_connections(server, server->poll_fds[i].fd);
+            ready_count--;
+        }
     }
     process_ready_events(server, ready_count);
 }
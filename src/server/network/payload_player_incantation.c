@@ -11,15 +11,19 @@
 
 #include "server/server.h"
 #include "server/server_updates.h"
+#include "server/map.h"
 
-static int append_players_to_buf(char **buf, player_t **players, int count)
+static int append_players_to_buf(char **buf, const player_t *occupant,
+    const player_t *initiator)
 {
     char *tmp = NULL;
     int ret;
 
-    for (int i = 0; i < count; ++i) {
+    for (; occupant; occupant = occupant->tile_next) {
+        if (occupant == initiator)
+            continue;
         tmp = NULL;
-        ret = asprintf(&tmp, "%s #%d", *buf, players[i]->id);
+        ret = asprintf(&tmp, "%s #%d", *buf, occupant->id);
         if (ret == -1) {
             free(*buf);
             return -1;
@@ -30,19 +34,20 @@ static int append_players_to_buf(char **buf, player_t **players, int count)
     return 0;
 }
 
-char *gui_payload_pic(tile_t *tile, int level, player_t **players, int count)
+// The initiator comes first, then every other player on the tile
+char *gui_payload_pic(const map_t *map, tile_id_t tile,
+    const player_t *initiator)
 {
     char *buf = NULL;
     char *tmp2 = NULL;
     int ret;
 
-    ret = asprintf(&buf, "pic %d %d %d %d",
-        tile->players[0]->x,
-        tile->players[0]->y,
-        level, tile->players[0]->id);
+    ret = asprintf(&buf, "pic %d %d %d #%d", tile_x(map, tile),
+        tile_y(map, tile), initiator->level, initiator->id);
     if (ret == -1)
         return NULL;
-    if (append_players_to_buf(&buf, players, count) == -1)
+    if (append_players_to_buf(&buf, map_occupants(map, tile),
+        initiator) == -1)
         return NULL;
     ret = asprintf(&tmp2, "%s\n", buf);
     if (ret == -1) {
@@ -11,32 +11,34 @@
 
 #include "server/server.h"
 #include "server/server_updates.h"
+#include "server/map.h"
 
-static void format_tile_response(char **response, int x, int y,
-    const tile_t *tile)
+static void format_tile_response(char **response, const map_t *map,
+    tile_id_t tile)
 {
     if (asprintf(response, "bct %d %d %d %d %d %d %d %d %d\n",
-        x, y, tile->resources[RESOURCE_FOOD],
-        tile->resources[RESOURCE_LINEMATE],
-        tile->resources[RESOURCE_DERAUMERE],
-        tile->resources[RESOURCE_SIBUR],
-        tile->resources[RESOURCE_MENDIANE],
-        tile->resources[RESOURCE_PHIRAS],
-        tile->resources[RESOURCE_THYSTAME]) == -1)
+        tile_x(map, tile), tile_y(map, tile),
+        map_stack(map, tile, RESOURCE_FOOD),
+        map_stack(map, tile, RESOURCE_LINEMATE),
+        map_stack(map, tile, RESOURCE_DERAUMERE),
+        map_stack(map, tile, RESOURCE_SIBUR),
+        map_stack(map, tile, RESOURCE_MENDIANE),
+        map_stack(map, tile, RESOURCE_PHIRAS),
+        map_stack(map, tile, RESOURCE_THYSTAME)) == -1)
         *response = NULL;
 }
 
 char *gui_payload_tile(server_t *server, int x, int y)
 {
     char *response;
-    tile_t *tile;
+    tile_id_t tile;
 
     if (!server || !server->game || !server->game->map)
         return NULL;
-    tile = map_get_tile(server->game->map, x, y);
-    if (!tile) {
+    tile = map_tile_at(server->game->map, x, y);
+    if (tile == TILE_NONE) {
         return NULL;
     }
-    format_tile_response(&response, x, y, tile);
+    format_tile_response(&response, server->game->map, tile);
     return response;
 }
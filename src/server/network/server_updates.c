@@ -18,5 +18,5 @@ void send_position_update(client_t *client, const player_t *player)
 
     snprintf(response, sizeof(response), "ppo #%d %d %d %d\n",
         player->id, player->x, player->y, player->orientation);
-    send(client->fd, response, strlen(response), 0);
+    send_response(client, response);
 }
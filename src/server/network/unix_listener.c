@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/network/unix_listener.c
+** File description:
+** Optional AF_UNIX listener for clients running on the same host
+*/
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include "server/server.h"
+
+// Only a leftover socket file is removed, never a regular file
+static int prepare_path(struct sockaddr_un *addr, const char *path)
+{
+    struct stat st;
+
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        LOG_ERROR("[SERVER] Unix socket path too long: %s", path);
+        return -1;
+    }
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+    return 0;
+}
+
+int unix_listener_create(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    if (prepare_path(&addr, path) == -1)
+        return -1;
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1)
+        return -1;
+    if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1 ||
+        bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+        listen(fd, SOMAXCONN) == -1) {
+        LOG_ERROR("[SERVER] Unix socket %s: %s", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    LOG_INFO("[SERVER] Listening on unix:%s", path);
+    return fd;
+}
+
+void unix_listener_destroy(int fd, const char *path)
+{
+    if (fd == -1)
+        return;
+    close(fd);
+    unlink(path);
+}
@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/object_pool.c
+** File description:
+** Fixed-size object pools backed by slabs and a free list
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/object_pool.h"
+#include "server/logger.h"
+
+int object_pool_init(object_pool_t *pool, const char *name,
+    size_t object_size, size_t slab_objects)
+{
+    memset(pool, 0, sizeof(*pool));
+    if (object_size < sizeof(pool_node_t))
+        object_size = sizeof(pool_node_t);
+    pool->name = name;
+    pool->object_size = (object_size + OBJECT_POOL_ALIGN - 1) &
+        ~(size_t)(OBJECT_POOL_ALIGN - 1);
+    pool->slab_objects = slab_objects ? slab_objects : 1;
+    return 0;
+}
+
+// Threads the new slab onto the free list back to front so objects are
+// handed out in address order
+static int grow_pool(object_pool_t *pool)
+{
+    void **slabs = realloc(pool->slabs,
+        (pool->slab_count + 1) * sizeof(*slabs));
+    unsigned char *slab;
+    pool_node_t *node;
+
+    if (!slabs)
+        return -1;
+    pool->slabs = slabs;
+    slab = malloc(pool->object_size * pool->slab_objects);
+    if (!slab)
+        return -1;
+    pool->slabs[pool->slab_count] = slab;
+    pool->slab_count++;
+    for (size_t i = pool->slab_objects; i > 0; --i) {
+        node = (pool_node_t *)(slab + (i - 1) * pool->object_size);
+        node->next = pool->free_list;
+        pool->free_list = node;
+    }
+    pool->capacity += pool->slab_objects;
+    return 0;
+}
+
+void *object_pool_alloc(object_pool_t *pool)
+{
+    pool_node_t *node;
+
+    if (!pool->free_list && grow_pool(pool) == -1)
+        return NULL;
+    node = pool->free_list;
+    pool->free_list = node->next;
+    pool->in_use++;
+    pool->allocations++;
+    if (pool->in_use > pool->peak)
+        pool->peak = pool->in_use;
+    memset(node, 0, pool->object_size);
+    return node;
+}
+
+void object_pool_free(object_pool_t *pool, void *object)
+{
+    pool_node_t *node = object;
+
+    if (!object)
+        return;
+    node->next = pool->free_list;
+    pool->free_list = node;
+    pool->in_use--;
+}
+
+void object_pool_log_stats(const object_pool_t *pool)
+{
+    LOG_INFO("[POOL] %s: %zu in use, %zu capacity, peak %zu, %zu served",
+        pool->name, pool->in_use, pool->capacity, pool->peak,
+        pool->allocations);
+}
+
+void object_pool_destroy(object_pool_t *pool)
+{
+    for (size_t i = 0; i < pool->slab_count; ++i)
+        free(pool->slabs[i]);
+    free(pool->slabs);
+    pool->slabs = NULL;
+    pool->slab_count = 0;
+    pool->free_list = NULL;
+    pool->capacity = 0;
+}
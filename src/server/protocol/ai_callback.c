@@ -39,5 +39,4 @@ void ai_callback_handler(client_t *client, void *data)
         && action_handlers[action_data->type]) {
         action_handlers[action_data->type](server, client, action_data->cmd);
     }
-    free(action_data);
 }
@@ -5,21 +5,34 @@
 ** AI command dispatch table implementation for protocol_ai
 */
 
+#include <string.h>
+
 #include "server/ai_commands.h"
 #include "server/protocol_ai.h"
 
-const ai_cmd_t ai_commands[] = {
-    {"Forward", 7, handle_forward},
-    {"Right", 5, handle_right},
-    {"Left", 4, handle_left},
-    {"Look", 4, handle_look},
-    {"Inventory", 9, handle_inventory},
-    {"Broadcast ", 10, handle_broadcast},
-    {"Connect_nbr", 11, handle_connect_nbr},
-    {"Fork", 4, handle_fork},
-    {"Eject", 5, handle_eject},
-    {"Take ", 5, handle_take},
-    {"Set ", 4, handle_set},
-    {"Incantation", 11, handle_incantation},
+const ai_cmd_t ai_commands[COMMAND_SLOTS] = {
+    AI_ENTRY('F', 'w', "Forward", handle_forward, false),
+    AI_ENTRY('R', 'h', "Right", handle_right, false),
+    AI_ENTRY('L', 't', "Left", handle_left, false),
+    AI_ENTRY('L', 'k', "Look", handle_look, false),
+    AI_ENTRY('I', 'e', "Inventory", handle_inventory, false),
+    AI_ENTRY('B', 'a', "Broadcast ", handle_broadcast, true),
+    AI_ENTRY('C', 'n', "Connect_nbr", handle_connect_nbr, false),
+    AI_ENTRY('F', 'k', "Fork", handle_fork, false),
+    AI_ENTRY('E', 'c', "Eject", handle_eject, false),
+    AI_ENTRY('T', 'e', "Take ", handle_take, true),
+    AI_ENTRY('S', ' ', "Set ", handle_set, true),
+    AI_ENTRY('I', 'a', "Incantation", handle_incantation, false),
 };
-const size_t ai_commands_count = sizeof(ai_commands) / sizeof(*ai_commands);
+
+const ai_cmd_t *ai_command_find(const char *cmd)
+{
+    const ai_cmd_t *entry;
+
+    if (!command_has_key(cmd, AI_KEY_INDEX))
+        return NULL;
+    entry = &ai_commands[COMMAND_SLOT(cmd[0], cmd[AI_KEY_INDEX])];
+    if (!entry->name || strncmp(cmd, entry->name, entry->len) != 0)
+        return NULL;
+    return entry;
+}
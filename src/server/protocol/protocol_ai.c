@@ -24,43 +24,93 @@
 void protocol_handle_ai_command(server_t *server,
     client_t *client, const char *cmd)
 {
-    printf("AI command: %s\n", cmd);
+    const ai_cmd_t *entry;
+
+    LOG_DEBUG("AI command: %s", cmd);
     if (!server || !client || !cmd) {
         return;
     }
-    for (size_t i = 0; i < ai_commands_count; ++i) {
-        if (strncmp(cmd, ai_commands[i].name, ai_commands[i].len) != 0) {
-            continue;
-        }
-        if (ai_commands[i].fn == handle_broadcast
-            || ai_commands[i].fn == handle_take
-            || ai_commands[i].fn == handle_set)
-            ai_commands[i].fn(server, client, cmd + ai_commands[i].len);
-        else
-            ai_commands[i].fn(server, client, NULL);
+    entry = ai_command_find(cmd);
+    if (!entry) {
+        send_response(client, "ko\n");
         return;
     }
-    send_response(client, "ko\n");
+    entry->fn(server, client, entry->has_arg ? cmd + entry->len : NULL);
 }
 
-void create_and_queue_action(server_t *server, client_t *client,
-    const char *cmd, const ai_action_type_t type)
+// Most arguments fit the inline buffer, only long broadcasts hit malloc
+static int store_command(action_t *action, const char *cmd)
 {
-    action_t *action;
+    size_t len;
+
+    if (!cmd)
+        return 0;
+    len = strlen(cmd);
+    action->command = len < ACTION_ARG_SIZE ?
+        action->inline_command : malloc(len + 1);
+    if (!action->command)
+        return -1;
+    memcpy(action->command, cmd, len + 1);
+    return 0;
+}
+
+static action_t *alloc_action(server_t *server, const char *cmd)
+{
+    action_t *action = object_pool_alloc(&server->action_pool);
+
+    if (!action)
+        return NULL;
+    action->data = object_pool_alloc(&server->action_data_pool);
+    if (!action->data || store_command(action, cmd) == -1) {
+        action_release(server, action);
+        return NULL;
+    }
+    return action;
+}
+
+static action_t *build_action(server_t *server, const char *cmd,
+    ai_action_type_t type)
+{
+    action_t *action = alloc_action(server, cmd);
     ai_action_data_t *data;
-    double now = client && client->action_queue_tail ?
-        client->action_queue_tail->exec_time : get_current_time();
 
-    if (!server || !client || client->action_queue_count >= 10)
-        return;
-    action = calloc(1, sizeof *action);
-    data = calloc(1, sizeof *data);
+    if (!action)
+        return NULL;
+    data = action->data;
     data->type = type;
     data->server = server;
-    action->command = cmd ? strdup(cmd) : NULL;
     data->cmd = action->command;
-    action->exec_time = now + get_time_unit(server) * ai_action_duration[type];
     action->callback = ai_callback_handler;
-    action->data = data;
-    queue_action(client, action);
+    return action;
+}
+
+void create_and_queue_action(server_t *server, client_t *client,
+    const char *cmd, const ai_action_type_t type)
+{
+    action_t *action;
+
+    if (!server || !client || client->action_queue_count >= 10)
+        return;
+    action = build_action(server, cmd, type);
+    if (!action)
+        return;
+    action->exec_tick = (client->action_queue_tail ?
+        client->action_queue_tail->exec_tick : server->tick_count) +
+        ai_action_duration[type];
+    queue_action(server, client, action);
+}
+
+int requeue_action(server_t *server, client_t *client, const char *cmd,
+    const ai_action_type_t type, uint64_t exec_tick)
+{
+    action_t *action;
+
+    if (type >= AI_ACTION_COUNT)
+        return -1;
+    action = build_action(server, cmd, type);
+    if (!action)
+        return -1;
+    action->exec_tick = exec_tick;
+    queue_action(server, client, action);
+    return 0;
 }
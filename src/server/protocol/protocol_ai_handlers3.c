@@ -10,10 +10,12 @@
 #include "server/vision.h"
 #include "server/incantation.h"
 #include "server/broadcast.h"
+#include "server/journal.h"
 #include "server/time.h"
 #include "server/resource.h"
 #include "server/lifecycle.h"
 #include "server/payloads.h"
+#include "server/map.h"
 
 void handle_set(server_t *server, client_t *client, const char *resource)
 {
@@ -22,7 +24,7 @@ void handle_set(server_t *server, client_t *client, const char *resource)
 
 void handle_incantation(server_t *server, client_t *client, const char *arg)
 {
-    tile_t *tile = NULL;
+    tile_id_t tile;
 
     if (!server || !client || !client->player ||
         !incantation_requirements_met(server, client->player)) {
@@ -31,11 +33,12 @@ void handle_incantation(server_t *server, client_t *client, const char *arg)
     }
     send_response(client, "Elevation underway\n");
     tile = get_player_tile(server, client->player);
-    if (!tile) {
+    if (tile == TILE_NONE) {
         send_response(client, "ko\n");
         return;
     }
-    broadcast_string_message_to_guis(server, gui_payload_pic(tile,
-        client->player->level, tile->players, tile->player_count));
+    broadcast_string_message_to_guis(server,
+        gui_payload_pic(server->game->map, tile, client->player));
+    journal_incantation(server, JOURNAL_PIC, client->player, false);
     return create_and_queue_action(server, client, arg, AI_ACTION_INCANTATION);
 }
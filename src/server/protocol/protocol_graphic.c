@@ -16,17 +16,16 @@
 #include "server/broadcast.h"
 #include "protocol_graphic_garbage.h"
 #include "server/time.h"
+#include "server/map.h"
 
 void protocol_send_tile_content(server_t *server, client_t *client,
     int x, int y)
 {
     char *response;
-    tile_t *tile;
 
     if (!server || !client || !server->game || !server->game->map)
         return;
-    tile = map_get_tile(server->game->map, x, y);
-    if (!tile) {
+    if (map_tile_at(server->game->map, x, y) == TILE_NONE) {
         send_response(client, "sbp\n");
         return;
     }
@@ -54,17 +53,15 @@ void protocol_send_player_info(client_t *client, const player_t *player)
 
 static void send_existing_players_after_map(server_t *server, client_t *client)
 {
-    static bool players_sent[1024] = {false};
-
-    if (client->fd >= 1024 || players_sent[client->fd])
+    if (client->players_sent)
         return;
     for (size_t i = 0; i < server->client_count; i++) {
-        if (server->clients[i].type == CLIENT_TYPE_AI &&
-            server->clients[i].player != NULL) {
-            protocol_send_player_info(client, server->clients[i].player);
+        if (server->clients[i]->type == CLIENT_TYPE_AI &&
+            server->clients[i]->player != NULL) {
+            protocol_send_player_info(client, server->clients[i]->player);
         }
     }
-    players_sent[client->fd] = true;
+    client->players_sent = true;
 }
 
 static void handle_map_size_command(server_t *server, client_t *client,
@@ -127,7 +124,7 @@ static void handle_player_level_command(server_t *server, client_t *client,
         send_response(client, "sbp\n");
         return;
     }
-    response = gui_payload_pin(client, player);
+    response = gui_payload_plv(client, player);
     if (!response) {
         send_response(client, "sbp\n");
         return;
@@ -136,39 +133,40 @@ static void handle_player_level_command(server_t *server, client_t *client,
     free(response);
 }
 
-static graphic_cmd_handler_t find_graphic_handler(const char *cmd)
+const graphic_cmd_entry_t graphic_commands[COMMAND_SLOTS] = {
+    GUI_ENTRY('m', 's', "msz", handle_map_size_command),
+    GUI_ENTRY('m', 'c', "mct", handle_map_content_command),
+    GUI_ENTRY('t', 'n', "tna", handle_team_names_command),
+    GUI_ENTRY('b', 'c', "bct ", handle_tile_content_command),
+    GUI_ENTRY('p', 'p', "ppo", handle_position_update),
+    GUI_ENTRY('p', 'i', "pin", handle_player_inventory),
+    GUI_ENTRY('s', 'g', "sgt", handle_time_unit_command),
+    GUI_ENTRY('s', 's', "sst", handle_time_unit_modification),
+    GUI_ENTRY('p', 'l', "plv", handle_player_level_command),
+};
+
+const graphic_cmd_entry_t *graphic_command_find(const char *cmd)
 {
-    const graphic_cmd_entry_t graphic_commands[] = {
-        {"msz", handle_map_size_command},
-        {"mct", handle_map_content_command},
-        {"tna", handle_team_names_command},
-        {"bct ", handle_tile_content_command},
-        {"ppo", handle_position_update},
-        {"pin", handle_player_inventory},
-        {"sgt", handle_time_unit_command},
-        {"sst", handle_time_unit_modification},
-        {"plv", handle_player_level_command},
-        {NULL, NULL}
-    };
-
-    for (size_t i = 0; graphic_commands[i].cmd != NULL; ++i) {
-        if (strncmp(cmd, graphic_commands[i].cmd,
-            strlen(graphic_commands[i].cmd)) == 0)
-            return graphic_commands[i].handler;
-    }
-    return NULL;
+    const graphic_cmd_entry_t *entry;
+
+    if (!command_has_key(cmd, GUI_KEY_INDEX))
+        return NULL;
+    entry = &graphic_commands[COMMAND_SLOT(cmd[0], cmd[GUI_KEY_INDEX])];
+    if (!entry->cmd || strncmp(cmd, entry->cmd, entry->len) != 0)
+        return NULL;
+    return entry;
 }
 
 void protocol_handle_graphic_command(server_t *server, client_t *client,
     const char *cmd)
 {
-    graphic_cmd_handler_t handler;
+    const graphic_cmd_entry_t *entry;
 
     if (!server || !client || !cmd)
         return;
-    handler = find_graphic_handler(cmd);
-    if (handler) {
-        handler(server, client, cmd);
+    entry = graphic_command_find(cmd);
+    if (entry) {
+        entry->handler(server, client, cmd);
     } else {
         send_response(client, "suc\n");
     }
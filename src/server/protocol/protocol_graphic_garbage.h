@@ -45,6 +45,7 @@ static inline void handle_player_inventory(server_t *server, client_t *client,
         return;
     }
     send_response(client, response);
+    free(response);
 }
 
 // sgt
@@ -6,19 +6,30 @@
 */
 
 #include "server/server.h"
+#include "server/io_pool.h"
+#include "server/tick_pool.h"
 #include <sys/socket.h>
 #include <string.h>
 #include <stdio.h>
 
 void send_response(client_t *client, const char *response)
 {
+    size_t len;
     ssize_t sent;
 
-    if (!client || !response)
+    if (!client || !response || tick_capture(client, response))
         return;
-    sent = send(client->fd, response, strlen(response), 0);
-    printf("[SERVER] Sent response to client %d: %s", client->fd, response);
-    (void)sent;
+    len = strlen(response);
+    client->traffic.messages_out++;
+    client->traffic.bytes_out += len;
+    if (client->io) {
+        io_pool_send(client, response, len);
+    } else {
+        sent = send(client->fd, response, len, 0);
+        (void)sent;
+    }
+    LOG_DEBUG("[SERVER] Sent response to client %d: %s",
+        client->fd, response);
 }
 
 void protocol_send_map_size(server_t *server, client_t *client)
@@ -12,53 +12,37 @@
 #include "server/game.h"
 #include "server/broadcast.h"
 #include "server/server_updates.h"
+#include "server/map.h"
 
 int take_resource(client_t *client, map_t *map, int resource_id)
 {
-    tile_t *tile;
+    tile_id_t tile;
 
     assert(client && map && resource_id >= 0 && resource_id < RESOURCE_COUNT);
-    tile = map_get_tile(map, client->player->x, client->player->y);
-    if (!tile || tile->resources[resource_id] <= 0) {
-        printf("No resource of type %d available\n", resource_id);
+    tile = map_tile_at(map, client->player->x, client->player->y);
+    if (tile == TILE_NONE || map_stack(map, tile, resource_id) <= 0) {
+        LOG_DEBUG("No resource of type %d available", resource_id);
         return -1;
     }
-    tile->resources[resource_id]--;
+    map_add_resource(map, tile, resource_id, -1);
     return 0;
 }
 
-static int count_resource_on_map(map_t *map, int type)
-{
-    int count = 0;
-    int x;
-    int y;
-    tile_t *tile;
-
-    for (y = 0; y < map->height; ++y) {
-        for (x = 0; x < map->width; ++x) {
-            tile = map_get_tile(map, x, y);
-            count += tile ? tile->resources[type] : 0;
-        }
-    }
-    return count;
-}
-
 static void place_resource_type(server_t *server, int type)
 {
     int target_quantity = ressource_quantity(server->game->map, type);
-    int current_quantity = count_resource_on_map(server->game->map, type);
-    int to_add = target_quantity - current_quantity;
+    int to_add = target_quantity - server->game->map->totals[type];
     int x;
     int y;
-    tile_t *tile;
+    tile_id_t tile;
 
     for (int i = 0; i < to_add; i++) {
-        x = rand() % server->game->map->width;
-        y = rand() % server->game->map->height;
-        tile = map_get_tile(server->game->map, x, y);
-        if (tile) {
-            tile->resources[type]++;
-            broadcast_tile_to_guis(server, x, y);
+        x = rng_below(&server->rng, server->game->map->width);
+        y = rng_below(&server->rng, server->game->map->height);
+        tile = map_tile_at(server->game->map, x, y);
+        if (tile != TILE_NONE) {
+            map_add_resource(server->game->map, tile, type, 1);
+            map_mark_dirty(server->game->map, tile);
         } else {
             --i;
         }
@@ -71,6 +55,7 @@ void respawn_resources(server_t *server)
 
     if (!server)
         return;
+    MAP_CHECK_TOTALS(server->game->map);
     for (type = 0; type < RESOURCE_COUNT; type++)
         place_resource_type(server, type);
 }
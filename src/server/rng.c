@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/rng.c
+** File description:
+** Seeded pseudo-random generator for the simulation
+*/
+
+#include "server/rng.h"
+
+static uint64_t rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t *state)
+{
+    uint64_t z;
+
+    *state += RNG_GAMMA;
+    z = *state;
+    z = (z ^ (z >> 30)) * RNG_MIX1;
+    z = (z ^ (z >> 27)) * RNG_MIX2;
+    return z ^ (z >> 31);
+}
+
+// splitmix64 never yields four zero words, the one state xoshiro rejects
+void rng_seed(rng_t *rng, uint64_t seed)
+{
+    for (int i = 0; i < 4; ++i)
+        rng->s[i] = splitmix64(&seed);
+}
+
+uint64_t rng_next(rng_t *rng)
+{
+    uint64_t *s = rng->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// Multiply-shift instead of modulo: no division and no low-bit bias
+uint32_t rng_below(rng_t *rng, uint32_t bound)
+{
+    return (uint32_t)(((rng_next(rng) >> 32) * bound) >> 32);
+}
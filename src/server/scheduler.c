@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/scheduler.c
+** File description:
+** Min-heap of the next due action of every client
+*/
+
+#include "server/scheduler.h"
+#include "server/time.h"
+
+static bool entry_before(const schedule_entry_t *a, const schedule_entry_t *b)
+{
+    if (a->exec_tick != b->exec_tick)
+        return a->exec_tick < b->exec_tick;
+    return a->seq < b->seq;
+}
+
+// Every move goes through here so client->schedule_index stays in sync
+static void place(scheduler_t *scheduler, size_t i, schedule_entry_t entry)
+{
+    scheduler->entries[i] = entry;
+    entry.client->schedule_index = i + 1;
+}
+
+static void sift_up(scheduler_t *scheduler, size_t i)
+{
+    schedule_entry_t entry = scheduler->entries[i];
+    size_t parent;
+
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (!entry_before(&entry, &scheduler->entries[parent]))
+            break;
+        place(scheduler, i, scheduler->entries[parent]);
+        i = parent;
+    }
+    place(scheduler, i, entry);
+}
+
+static void sift_down(scheduler_t *scheduler, size_t i)
+{
+    schedule_entry_t entry = scheduler->entries[i];
+    size_t child;
+
+    while (2 * i + 1 < scheduler->count) {
+        child = 2 * i + 1;
+        if (child + 1 < scheduler->count && entry_before(
+            &scheduler->entries[child + 1], &scheduler->entries[child]))
+            child++;
+        if (!entry_before(&scheduler->entries[child], &entry))
+            break;
+        place(scheduler, i, scheduler->entries[child]);
+        i = child;
+    }
+    place(scheduler, i, entry);
+}
+
+static void restore(scheduler_t *scheduler, size_t i)
+{
+    if (i > 0 && entry_before(&scheduler->entries[i],
+        &scheduler->entries[(i - 1) / 2]))
+        sift_up(scheduler, i);
+    else
+        sift_down(scheduler, i);
+}
+
+static int reserve_entry(scheduler_t *scheduler)
+{
+    size_t capacity = scheduler->capacity ? scheduler->capacity * 2 : 64;
+    schedule_entry_t *entries;
+
+    if (scheduler->count < scheduler->capacity)
+        return 0;
+    entries = realloc(scheduler->entries, capacity * sizeof(*entries));
+    if (!entries)
+        return -1;
+    scheduler->entries = entries;
+    scheduler->capacity = capacity;
+    return 0;
+}
+
+int scheduler_update(scheduler_t *scheduler, client_t *client)
+{
+    action_t *head = client->action_queue_head;
+    size_t i;
+
+    if (!head) {
+        scheduler_remove(scheduler, client);
+        return 0;
+    }
+    if (client->schedule_index == 0) {
+        if (reserve_entry(scheduler) == -1)
+            return -1;
+        i = scheduler->count;
+        scheduler->count++;
+    } else {
+        i = client->schedule_index - 1;
+    }
+    scheduler->entries[i] = (schedule_entry_t){head->exec_tick, head->seq,
+        client};
+    restore(scheduler, i);
+    return 0;
+}
+
+void scheduler_remove(scheduler_t *scheduler, client_t *client)
+{
+    size_t i = client->schedule_index;
+
+    if (i == 0)
+        return;
+    i--;
+    client->schedule_index = 0;
+    scheduler->count--;
+    if (i == scheduler->count)
+        return;
+    place(scheduler, i, scheduler->entries[scheduler->count]);
+    restore(scheduler, i);
+}
+
+client_t *scheduler_peek_due(const scheduler_t *scheduler, uint64_t tick)
+{
+    if (scheduler->count == 0 || scheduler->entries[0].exec_tick > tick)
+        return NULL;
+    return scheduler->entries[0].client;
+}
+
+void scheduler_destroy(scheduler_t *scheduler)
+{
+    free(scheduler->entries);
+    scheduler->entries = NULL;
+    scheduler->count = 0;
+    scheduler->capacity = 0;
+}
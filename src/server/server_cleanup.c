@@ -8,17 +8,23 @@
 #include "server/server.h"
 #include "server/time.h"
 #include "server/dynamic_array.h"
+#include "server/client_slab.h"
+#include "server/io_pool.h"
+#include "server/tick_pool.h"
+#include "server/egg.h"
+#include "server/snapshot.h"
+#include "server/journal.h"
+#include "server/metrics.h"
 #include <unistd.h>
 
-static void clean_action_queue(client_t *client)
+static void clean_action_queue(server_t *server, client_t *client)
 {
     action_t *action = client->action_queue_head;
     action_t *next;
 
     while (action) {
         next = action->next;
-        free(action->command);
-        free(action);
+        action_release(server, action);
         action = next;
     }
     client->action_queue_head = NULL;
@@ -26,14 +32,15 @@ static void clean_action_queue(client_t *client)
     client->action_queue_count = 0;
 }
 
-static void close_client_connection(client_t *client)
+static void close_client_connection(server_t *server, client_t *client)
 {
     if (!client)
         return;
-    if (client->fd != -1) {
+    if (client->io)
+        io_pool_detach(client);
+    else if (client->fd != -1)
         close(client->fd);
-        client->fd = -1;
-    }
+    client->fd = -1;
     if (client->buffer) {
         free(client->buffer);
         client->buffer = NULL;
@@ -42,19 +49,22 @@ static void close_client_connection(client_t *client)
         free(client->team_name);
         client->team_name = NULL;
     }
-    clean_action_queue(client);
+    clean_action_queue(server, client);
 }
 
 static void cleanup_all_clients(server_t *server)
 {
-    size_t i;
+    for (size_t i = 0; i < server->client_count; i++)
+        close_client_connection(server, server->clients[i]);
+    client_storage_destroy(server);
+}
 
-    if (!server->clients)
-        return;
-    for (i = 0; i < server->client_count; i++)
-        close_client_connection(&server->clients[i]);
-    free(server->clients);
-    server->clients = NULL;
+static void cleanup_action_pools(server_t *server)
+{
+    object_pool_log_stats(&server->action_pool);
+    object_pool_log_stats(&server->action_data_pool);
+    object_pool_destroy(&server->action_pool);
+    object_pool_destroy(&server->action_data_pool);
 }
 
 static void cleanup_server_socket(server_t *server)
@@ -63,6 +73,10 @@ static void cleanup_server_socket(server_t *server)
         close(server->server_fd);
         server->server_fd = -1;
     }
+    unix_listener_destroy(server->unix_fd, server->config.unix_path);
+    server->unix_fd = -1;
+    unix_listener_destroy(server->admin_fd, server->config.admin_path);
+    server->admin_fd = -1;
 }
 
 static void cleanup_game_state(server_t *server)
@@ -85,16 +99,20 @@ void server_destroy(server_t *server)
 {
     if (!server)
         return;
-    printf("[SERVER] Cleaning up server resources\n");
+    LOG_INFO("[SERVER] Cleaning up server resources");
+    journal_close(server);
+    metrics_close(server);
     cleanup_all_clients(server);
+    scheduler_destroy(&server->scheduler);
+    cleanup_action_pools(server);
+    tick_pool_destroy(server);
+    io_pool_destroy(server);
     cleanup_server_socket(server);
     signal_handler_cleanup(server->signal_fd);
     cleanup_game_state(server);
+    snapshot_parked_destroy(server);
     cleanup_poll_fds(server);
-    if (server->eggs) {
-        da_destroy(server->eggs);
-        server->eggs = NULL;
-    }
+    egg_manager_destroy(server);
     server->is_running = false;
-    printf("[SERVER] Cleanup completed\n");
+    LOG_INFO("[SERVER] Cleanup completed");
 }
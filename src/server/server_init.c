@@ -10,14 +10,27 @@
 #include <netinet/in.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
+#include <sys/resource.h>
 #include "server/dynamic_array.h"
+#include "server/io_pool.h"
+#include "server/tick_pool.h"
+#include "server/time.h"
+#include "server/protocol_ai.h"
+#include "server/egg.h"
+#include "server/host.h"
+#include "server/snapshot.h"
+#include "server/journal.h"
+#include "server/metrics.h"
 
+// Non-blocking so a connection storm can be drained in one poll wake-up
 static int setup_socket_options(int fd)
 {
     int opt = 1;
 
-    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) < 0) {
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) < 0 ||
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1) {
         close(fd);
         return -1;
     }
@@ -39,7 +52,7 @@ static int bind_socket_to_port(int fd, size_t port)
     return 0;
 }
 
-static int create_server_socket(size_t port)
+int tcp_listener_create(size_t port)
 {
     int fd = socket(AF_INET, SOCK_STREAM, 0);
 
@@ -49,34 +62,46 @@ static int create_server_socket(size_t port)
         return -1;
     if (bind_socket_to_port(fd, port) == -1)
         return -1;
-    if (listen(fd, 10) == -1) {
+    if (listen(fd, SOMAXCONN) == -1) {
         close(fd);
         return -1;
     }
     return fd;
 }
 
-// 1 is fo the gui team
+// Client slots grow on demand, the only hard cap is the descriptor limit
+static size_t raise_fd_limit(void)
+{
+    struct rlimit limit;
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) == -1)
+        return CLIENT_SLAB_SIZE;
+    if (limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max > MAX_FD_LIMIT ?
+            MAX_FD_LIMIT : limit.rlim_max;
+        if (setrlimit(RLIMIT_NOFILE, &limit) == -1)
+            getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (limit.rlim_cur == RLIM_INFINITY || limit.rlim_cur > MAX_FD_LIMIT)
+        limit.rlim_cur = MAX_FD_LIMIT;
+    if (limit.rlim_cur <= RESERVED_FDS)
+        return 1;
+    return limit.rlim_cur - RESERVED_FDS;
+}
+
 static int allocate_clients_array(server_t *server)
 {
-    server->eggs = da_create();
-    server->client_capacity = server->config.max_clients_per_team *
-        (server->config.team_count + 1);
-    server->clients = calloc(server->client_capacity, sizeof(client_t));
-    if (!server->clients)
-        return -1;
+    server->free_slots = da_create();
+    server->max_clients = raise_fd_limit();
+    LOG_INFO("[SERVER] Client limit: %zu", server->max_clients);
     return 0;
 }
 
 static int allocate_poll_fds_array(server_t *server)
 {
-    server->poll_fds = calloc(server->client_capacity + 1,
-        sizeof(struct pollfd));
-    if (!server->poll_fds) {
-        free(server->clients);
-        server->clients = NULL;
+    server->poll_fds = calloc(server->listener_count, sizeof(struct pollfd));
+    if (!server->poll_fds)
         return -1;
-    }
     return 0;
 }
 
@@ -86,36 +111,67 @@ static int allocate_server_memory(server_t *server)
         return -1;
     if (allocate_poll_fds_array(server) == -1)
         return -1;
-    return 0;
+    object_pool_init(&server->action_pool, "actions",
+        sizeof(action_t), ACTION_POOL_SLAB);
+    object_pool_init(&server->action_data_pool, "action data",
+        sizeof(ai_action_data_t), ACTION_POOL_SLAB);
+    return egg_manager_init(server);
 }
 
-static void initialize_clients(server_t *server)
+static void setup_initial_poll_state(server_t *server)
 {
-    size_t i;
-    client_t *client;
-
-    for (i = 0; i < server->client_capacity; i++) {
-        client = &server->clients[i];
-        client->fd = -1;
-        client->type = CLIENT_TYPE_UNKNOWN;
-        client->buffer = NULL;
-        client->buffer_size = 0;
-        client->buffer_pos = 0;
-        client->is_authenticated = false;
-        client->team_name = NULL;
-        client->action_queue_head = NULL;
-        client->action_queue_tail = NULL;
-        client->action_queue_count = 0;
+    int listeners[] = {server->server_fd, server->unix_fd, server->admin_fd};
+    size_t count = 0;
+
+    server->client_count = 0;
+    server->poll_count = server->listener_count;
+    server->is_running = true;
+    for (size_t i = 0; i < sizeof(listeners) / sizeof(*listeners); ++i) {
+        if (listeners[i] == -1)
+            continue;
+        server->poll_fds[count].fd = listeners[i];
+        server->poll_fds[count].events = POLLIN;
+        count++;
     }
 }
 
-static void setup_initial_poll_state(server_t *server)
+static void close_listeners(server_t *server, const server_config_t *config)
 {
-    server->client_count = 0;
-    server->poll_count = 1;
-    server->is_running = true;
-    server->poll_fds[0].fd = server->server_fd;
-    server->poll_fds[0].events = POLLIN;
+    close(server->server_fd);
+    unix_listener_destroy(server->unix_fd, config->unix_path);
+    unix_listener_destroy(server->admin_fd, config->admin_path);
+}
+
+static int open_unix_listener(server_t *server, const char *path, int *fd)
+{
+    if (!path || server->host)
+        return 0;
+    *fd = unix_listener_create(path);
+    if (*fd == -1)
+        return -1;
+    server->listener_count++;
+    return 0;
+}
+
+// TCP is always served, then the unix and admin sockets when requested,
+// in that order. A hosted game listens to its host's hand-off descriptor
+// instead.
+static int create_listeners(server_t *server, const server_config_t *config)
+{
+    server->unix_fd = -1;
+    server->admin_fd = -1;
+    server->server_fd = server->host ? host_game_listener(server->host) :
+        tcp_listener_create(config->port);
+    if (server->server_fd == -1)
+        return -1;
+    server->listener_count = 1;
+    if (open_unix_listener(server, config->unix_path,
+        &server->unix_fd) == -1 || open_unix_listener(server,
+        config->admin_path, &server->admin_fd) == -1) {
+        close_listeners(server, config);
+        return -1;
+    }
+    return 0;
 }
 
 static int initialize_server_components(server_t *server,
@@ -124,31 +180,51 @@ static int initialize_server_components(server_t *server,
     server->signal_fd = signal_handler_init();
     if (server->signal_fd == -1)
         return -1;
-    server->server_fd = create_server_socket(config->port);
-    if (server->server_fd == -1) {
+    if (create_listeners(server, config) == -1) {
         signal_handler_cleanup(server->signal_fd);
         return -1;
     }
     return 0;
 }
 
+// The worker pools come last, the tick pool sizes its regions on the map.
+// A restored game replaces the fresh one before any client can see it,
+// and the journal and metrics open on whichever is played.
+static int start_game(server_t *server)
+{
+    server->game = game_state_create(server, &server->config);
+    if (!server->game || (server->config.restore_path &&
+        snapshot_restore(server, server->config.restore_path) == -1) ||
+        io_pool_create(server) == -1 ||
+        tick_pool_create(server) == -1 ||
+        journal_open(server) == -1 || metrics_open(server) == -1)
+        return -1;
+    return 0;
+}
+
 int server_create(server_t *server, const server_config_t *config)
+{
+    return server_create_hosted(server, config, NULL);
+}
+
+int server_create_hosted(server_t *server, const server_config_t *config,
+    host_game_t *host)
 {
     if (!server || !config)
         return -1;
     memset(server, 0, sizeof(server_t));
     server->config = *config;
+    server->host = host;
+    rng_seed(&server->rng, config->seed);
     if (initialize_server_components(server, config) == -1)
         return -1;
     if (allocate_server_memory(server) == -1) {
-        close(server->server_fd);
+        close_listeners(server, config);
         signal_handler_cleanup(server->signal_fd);
         return -1;
     }
     setup_initial_poll_state(server);
-    initialize_clients(server);
-    server->game = game_state_create(server, &server->config);
-    if (!server->game) {
+    if (start_game(server) == -1) {
         server_destroy(server);
         return -1;
     }
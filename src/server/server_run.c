@@ -8,132 +8,227 @@
 #include "server/resource.h"
 #include "server/server.h"
 #include "server/server_broadcast.h"
+#include "server/broadcast.h"
 #include "server/time.h"
 #include "server/lifecycle.h"
 #include "server/win_condition.h"
+#include "server/io_pool.h"
+#include "server/tick_pool.h"
+#include "server/host.h"
+#include "server/snapshot.h"
+#include "server/journal.h"
+#include "server/metrics.h"
 #include <errno.h>
 #include <string.h>
-#include <sys/time.h>
 #include <unistd.h>
 
 static void print_server_teams(const server_t *server)
 {
-    size_t i;
-
-    printf("[SERVER] Teams: ");
-    for (i = 0; i < server->config.team_count; i++) {
-        printf("%s", server->config.team_names[i]);
-        if (i < server->config.team_count - 1)
-            printf(", ");
-    }
-    printf("\n");
+    char teams[1024] = {0};
+    size_t len = 0;
+
+    for (size_t i = 0; i < server->config.team_count &&
+        len < sizeof(teams); i++)
+        len += snprintf(teams + len, sizeof(teams) - len, "%s%s",
+            i > 0 ? ", " : "", server->config.team_names[i]);
+    LOG_INFO("[SERVER] Teams: %s", teams);
 }
 
 static void print_server_info(const server_t *server)
 {
-    printf("[SERVER] Starting Enhanced Zappy server\n");
-    printf("[SERVER] Port: %zu\n", server->config.port);
-    printf("[SERVER] Map: %zux%zu\n", server->config.width,
+    LOG_INFO("[SERVER] Starting Enhanced Zappy server");
+    LOG_INFO("[SERVER] Port: %zu", server->config.port);
+    LOG_INFO("[SERVER] Map: %zux%zu", server->config.width,
         server->config.height);
     print_server_teams(server);
-    printf("[SERVER] Time frequency: %zu\n", server->config.freq);
-    printf("[SERVER] Resource refill: %s\n",
+    LOG_INFO("[SERVER] Time frequency: %zu", server->config.freq);
+    LOG_INFO("[SERVER] Seed: %llu", (unsigned long long)server->config.seed);
+    LOG_INFO("[SERVER] Resource refill: %s",
         server->config.refill_tiles ? "enabled" : "disabled");
-    printf("[SERVER] Listening for connections...\n\n");
+    if (server->config.turbo)
+        LOG_INFO("[SERVER] Turbo: ticks run as soon as every player waits");
+    LOG_INFO("[SERVER] Listening for connections...");
 }
 
+// Signals belong to the host when games are hosted, it stops them itself
 static int check_for_shutdown_signal(server_t *server)
 {
-    if (signal_handler_check(server->signal_fd)) {
-        printf("\n[SERVER] Shutdown signal received\n");
+    if (server->host ? host_game_stopping(server) :
+        signal_handler_check(server->signal_fd)) {
+        LOG_INFO("[SERVER] Shutdown signal received");
         server->is_running = false;
         return 1;
     }
     return 0;
 }
 
-static double calculate_delta_time(double *last_time)
+// Turbo: once every player waits on a queued action, no client can act
+// before the earliest of them completes, so the next tick can run now
+static bool turbo_ready(const server_t *server)
+{
+    return server->config.turbo && server->game &&
+        server->game->player_count > 0 &&
+        server->scheduler.count >= server->game->player_count;
+}
+
+// Sleeps at most POLL_INTERVAL, less when the next tick is due sooner
+static struct timespec get_poll_timeout(const server_t *server)
+{
+    double delay = server->next_tick_time - get_current_time();
+    struct timespec timeout = {0, 0};
+
+    if (turbo_ready(server))
+        return timeout;
+    if (delay > POLL_INTERVAL)
+        delay = POLL_INTERVAL;
+    if (delay > 0.0)
+        timeout.tv_nsec = (long)(delay * 1e9);
+    return timeout;
+}
+
+// The admin socket is the last listener, see server_init.c; its slot
+// watches the connection being answered when there is one
+static void watch_admin(server_t *server)
+{
+    if (server->admin_fd != -1)
+        server->poll_fds[server->listener_count - 1] =
+            metrics_admin_pollfd(server);
+}
+
+// The admin slot is answered first, so queries do not count as poll time
+static void handle_ready(server_t *server, int ready)
 {
-    double current_time = get_current_time();
-    double delta = current_time - *last_time;
+    uint64_t started;
 
-    *last_time = current_time;
-    return delta;
+    if (ready > 0 && server->admin_fd != -1)
+        ready -= metrics_admin_handle(server,
+            &server->poll_fds[server->listener_count - 1]);
+    if (ready <= 0)
+        return;
+    started = metrics_start(server);
+    network_handle_events(server, ready);
+    metrics_lap(server, METRICS_POLL, started);
 }
 
 static int handle_poll_events(server_t *server)
 {
-    int ready = poll(server->poll_fds, server->poll_count, 2);
+    struct timespec timeout = get_poll_timeout(server);
+    int ready;
 
+    if (server->io)
+        return io_pool_poll(server, &timeout);
+    watch_admin(server);
+    ready = ppoll(server->poll_fds, server->poll_count, &timeout, NULL);
     if (ready == -1) {
         if (errno == EINTR)
             return 0;
-        printf("[SERVER] Poll error: %s\n", strerror(errno));
+        LOG_ERROR("[SERVER] Poll error: %s", strerror(errno));
         return -1;
     }
-    if (ready > 0)
-        network_handle_events(server, ready);
+    handle_ready(server, ready);
     return 0;
 }
 
 static void check_for_death(server_t *server)
 {
-    player_t *player;
+    client_t *client;
+    size_t i = 0;
 
     if (!server || !server->game)
         return;
-    for (size_t i = 0; i < server->client_count; ++i) {
-        player = server->clients[i].player;
-        if (server->clients[i].type == CLIENT_TYPE_AI &&
-            player && !player->is_alive) {
-            client_remove(server, i);
-            i--;
+    while (i < server->client_count) {
+        client = server->clients[i];
+        if (client->type == CLIENT_TYPE_AI &&
+            client->player && !client->player->is_alive) {
+            client_remove(server, client);
+            continue;
         }
+        i++;
     }
 }
 
-static void update_game_and_broadcast(server_t *server, double delta_time)
+// Each phase is timed from where the previous one ended
+static void run_world(server_t *server, uint64_t mark)
 {
     int winning_team;
 
-    if (server->config.refill_tiles && server->tick_count % 20 == 0)
+    if (server->config.refill_tiles && server->tick_count % 20 == 0) {
         respawn_resources(server);
-    if (server->game)
-        game_state_update(server, delta_time);
-    process_actions(server);
+        mark = metrics_lap(server, METRICS_RESPAWN, mark);
+    }
+    tick_pool_update_players(server);
     check_for_death(server);
+    mark = metrics_lap(server, METRICS_FOOD, mark);
+    broadcast_dirty_tiles(server);
+    mark = metrics_lap(server, METRICS_TILES, mark);
     winning_team = check_win_condition(server);
-    if (winning_team >= 0) {
+    if (winning_team >= 0)
         handle_game_win(server, winning_team);
+    metrics_lap(server, METRICS_WIN, mark);
+}
+
+// One simulation step: the actions due at this tick, then the world
+static void run_tick(server_t *server)
+{
+    uint64_t started = metrics_start(server);
+
+    server->tick_count++;
+    tick_pool_process_actions(server);
+    run_world(server, metrics_lap(server, METRICS_ACTIONS, started));
+    snapshot_tick(server);
+    journal_tick(server);
+    host_game_publish(server);
+    metrics_lap(server, METRICS_TICK, started);
+}
+
+// The wall clock only paces ticks. A server that fell more than
+// MAX_TICK_CATCHUP ticks behind drops the backlog instead of bursting, and
+// an early turbo tick pushes the next deadline one unit past now.
+static void run_due_ticks(server_t *server)
+{
+    double now = get_current_time();
+    double unit = get_time_unit(server);
+    bool late;
+
+    for (size_t ran = 0; server->is_running; ++ran) {
+        late = now >= server->next_tick_time;
+        if (!late && !turbo_ready(server))
+            return;
+        if (ran == MAX_TICK_CATCHUP) {
+            server->next_tick_time = now + unit;
+            return;
+        }
+        run_tick(server);
+        server->next_tick_time = late ?
+            server->next_tick_time + unit : now + unit;
     }
 }
 
-static void wait_for_next_tick(server_t *server, double delta_time)
+static void report_tick_rate(const server_t *server, double started)
 {
-    static double accumulated_time = 0.0;
-    double time_unit = get_time_unit(server);
+    double elapsed = get_current_time() - started;
 
-    accumulated_time += delta_time;
-    if (accumulated_time < time_unit)
+    if (!server->config.turbo)
         return;
-    accumulated_time -= time_unit;
-    server->tick_count++;
-    update_game_and_broadcast(server, delta_time);
+    LOG_INFO("[SERVER] Turbo: %llu ticks in %.3fs, %.0f ticks/s",
+        (unsigned long long)server->tick_count, elapsed,
+        elapsed > 0.0 ? (double)server->tick_count / elapsed : 0.0);
 }
 
 void server_run(server_t *server)
 {
-    double last_time = get_current_time();
-    double delta_time;
+    double started = get_current_time();
 
     print_server_info(server);
+    server->next_tick_time = started + get_time_unit(server);
     while (server->is_running) {
-        delta_time = calculate_delta_time(&last_time);
         if (check_for_shutdown_signal(server))
             break;
         if (handle_poll_events(server) == -1)
             break;
-        wait_for_next_tick(server, delta_time);
+        run_due_ticks(server);
     }
-    printf("[SERVER] Server shutting down\n");
+    report_tick_rate(server, started);
+    snapshot_shutdown(server);
+    LOG_INFO("[SERVER] Server shutting down");
 }
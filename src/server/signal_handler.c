@@ -10,6 +10,9 @@
 #include <errno.h>
 #include <time.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "server/logger.h"
 
 int signal_handler_init(void)
 {
@@ -20,17 +23,17 @@ int signal_handler_init(void)
     sigaddset(&mask, SIGTERM);
     sigaddset(&mask, SIGQUIT);
     if (sigprocmask(SIG_BLOCK, &mask, NULL) == -1) {
-        perror("sigprocmask");
+        LOG_ERROR("sigprocmask: %s", strerror(errno));
         return -1;
     }
-    printf("[SERVER] Signal handler initialized\n");
+    LOG_INFO("[SERVER] Signal handler initialized");
     return 0;
 }
 
 void signal_handler_cleanup(int signal_fd)
 {
     (void)signal_fd;
-    printf("[SERVER] Signal handler cleaned up\n");
+    LOG_INFO("[SERVER] Signal handler cleaned up");
 }
 
 int signal_handler_check(int signal_fd)
@@ -46,7 +49,7 @@ int signal_handler_check(int signal_fd)
     sigaddset(&mask, SIGQUIT);
     sig = sigtimedwait(&mask, NULL, &timeout);
     if (sig > 0) {
-        printf("[SERVER] Received shutdown signal: %d\n", sig);
+        LOG_INFO("[SERVER] Received shutdown signal: %d", sig);
         return 1;
     }
     return 0;
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot.c
+** File description:
+** Snapshot writers forked between two ticks
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "snapshot_internal.h"
+
+static void reap_writer(server_t *server, bool block)
+{
+    int status = 0;
+    pid_t pid;
+
+    if (server->snapshot_pid <= 0)
+        return;
+    pid = waitpid(server->snapshot_pid, &status, block ? 0 : WNOHANG);
+    if (pid == 0)
+        return;
+    if (pid == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        LOG_WARN("[SNAPSHOT] Writing %s failed", server->config.snapshot_path);
+    else
+        LOG_DEBUG("[SNAPSHOT] %s written", server->config.snapshot_path);
+    server->snapshot_pid = 0;
+}
+
+// The child sees the game frozen by copy-on-write and only ever writes the
+// file; _exit keeps it from flushing anything it inherited
+static void fork_writer(server_t *server)
+{
+    double started = get_current_time();
+    pid_t pid = fork();
+
+    if (pid == 0)
+        _exit(snapshot_write(server, server->config.snapshot_path) ? 1 : 0);
+    if (pid == -1) {
+        LOG_WARN("[SNAPSHOT] fork: %s", strerror(errno));
+        return;
+    }
+    server->snapshot_pid = pid;
+    LOG_DEBUG("[SNAPSHOT] Tick %llu forked in %.3f ms",
+        (unsigned long long)server->tick_count,
+        (get_current_time() - started) * 1e3);
+}
+
+void snapshot_tick(server_t *server)
+{
+    if (!server->config.snapshot_path)
+        return;
+    reap_writer(server, false);
+    if (server->config.snapshot_every == 0 ||
+        server->tick_count % server->config.snapshot_every != 0)
+        return;
+    if (server->snapshot_pid > 0) {
+        LOG_WARN("[SNAPSHOT] Tick %llu skipped, the previous one is still "
+            "being written", (unsigned long long)server->tick_count);
+        return;
+    }
+    fork_writer(server);
+}
+
+void snapshot_shutdown(server_t *server)
+{
+    if (!server->config.snapshot_path)
+        return;
+    reap_writer(server, true);
+    if (snapshot_write(server, server->config.snapshot_path) == -1) {
+        LOG_ERROR("[SNAPSHOT] Cannot write %s: %s",
+            server->config.snapshot_path, strerror(errno));
+        return;
+    }
+    LOG_INFO("[SNAPSHOT] Tick %llu saved to %s",
+        (unsigned long long)server->tick_count, server->config.snapshot_path);
+}
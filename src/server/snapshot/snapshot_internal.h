@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_internal.h
+** File description:
+** Checksummed reader and writer of the snapshot format
+*/
+
+#ifndef SNAPSHOT_INTERNAL_H_
+    #define SNAPSHOT_INTERNAL_H_
+
+    #include <stdio.h>
+
+    #include "server/snapshot.h"
+
+    #define SNAP_HASH_SEED 0xCBF29CE484222325ULL
+    #define SNAP_HASH_PRIME 0x100000001B3ULL
+    #define SNAP_MAX_ACTIONS 64
+    // id, x, y, orientation, level, team, resources, flag, ages, actions
+    #define SNAP_PLAYER_MIN_SIZE (4 * 3 + 1 + 1 + 2 + 4 * RESOURCE_COUNT + 19)
+
+typedef struct snap_writer_s {
+    FILE *file;
+    uint64_t hash;
+    bool failed;
+} snap_writer_t;
+
+// failed sticks once a read runs past the end, later reads return zeroes
+typedef struct snap_reader_s {
+    unsigned char *data;
+    size_t size;
+    size_t pos;
+    bool failed;
+} snap_reader_t;
+
+// snapshot_io.c
+uint64_t snap_hash(uint64_t hash, const void *data, size_t size);
+void snap_put(snap_writer_t *w, const void *data, size_t size);
+void snap_get(snap_reader_t *r, void *data, size_t size);
+
+// Strings are a u16 length plus one, 0 standing for NULL; snap_get_string
+// returns a malloc'd copy and sets failed when it cannot
+void snap_put_string(snap_writer_t *w, const char *text);
+char *snap_get_string(snap_reader_t *r);
+
+// snapshot_write.c: the whole file, atomically replaced
+int snapshot_write(const server_t *server, const char *path);
+
+// snapshot_read.c
+int snapshot_read_players(server_t *server, snap_reader_t *r);
+int snapshot_read_eggs(server_t *server, snap_reader_t *r);
+
+static inline void snap_put_u8(snap_writer_t *w, uint8_t value)
+{
+    snap_put(w, &value, sizeof(value));
+}
+
+static inline void snap_put_u16(snap_writer_t *w, uint16_t value)
+{
+    snap_put(w, &value, sizeof(value));
+}
+
+static inline void snap_put_u32(snap_writer_t *w, uint32_t value)
+{
+    snap_put(w, &value, sizeof(value));
+}
+
+static inline void snap_put_u64(snap_writer_t *w, uint64_t value)
+{
+    snap_put(w, &value, sizeof(value));
+}
+
+static inline uint8_t snap_get_u8(snap_reader_t *r)
+{
+    uint8_t value = 0;
+
+    snap_get(r, &value, sizeof(value));
+    return value;
+}
+
+static inline uint16_t snap_get_u16(snap_reader_t *r)
+{
+    uint16_t value = 0;
+
+    snap_get(r, &value, sizeof(value));
+    return value;
+}
+
+static inline uint32_t snap_get_u32(snap_reader_t *r)
+{
+    uint32_t value = 0;
+
+    snap_get(r, &value, sizeof(value));
+    return value;
+}
+
+static inline uint64_t snap_get_u64(snap_reader_t *r)
+{
+    uint64_t value = 0;
+
+    snap_get(r, &value, sizeof(value));
+    return value;
+}
+
+#endif /* !SNAPSHOT_INTERNAL_H_ */
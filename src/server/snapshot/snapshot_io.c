@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_io.c
+** File description:
+** Checksummed reader and writer of the snapshot format
+*/
+
+#include <string.h>
+
+#include "snapshot_internal.h"
+
+uint64_t snap_hash(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= SNAP_HASH_PRIME;
+    }
+    return hash;
+}
+
+void snap_put(snap_writer_t *w, const void *data, size_t size)
+{
+    if (w->failed)
+        return;
+    w->hash = snap_hash(w->hash, data, size);
+    if (fwrite(data, 1, size, w->file) != size)
+        w->failed = true;
+}
+
+void snap_get(snap_reader_t *r, void *data, size_t size)
+{
+    if (r->failed || size > r->size - r->pos) {
+        r->failed = true;
+        memset(data, 0, size);
+        return;
+    }
+    memcpy(data, r->data + r->pos, size);
+    r->pos += size;
+}
+
+void snap_put_string(snap_writer_t *w, const char *text)
+{
+    size_t len = text ? strlen(text) : 0;
+
+    if (len >= UINT16_MAX) {
+        w->failed = true;
+        return;
+    }
+    snap_put_u16(w, text ? len + 1 : 0);
+    snap_put(w, text, len);
+}
+
+char *snap_get_string(snap_reader_t *r)
+{
+    uint16_t stored = snap_get_u16(r);
+    char *text;
+
+    if (r->failed || stored == 0)
+        return NULL;
+    text = malloc(stored);
+    if (!text) {
+        r->failed = true;
+        return NULL;
+    }
+    snap_get(r, text, stored - 1);
+    text[stored - 1] = '\0';
+    return text;
+}
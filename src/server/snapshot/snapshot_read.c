@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_read.c
+** File description:
+** Players and eggs of a snapshot
+*/
+
+#include "server/egg.h"
+#include "server/protocol_ai.h"
+#include "server/team.h"
+#include "snapshot_internal.h"
+
+static bool valid_fields(const server_t *server, const parked_player_t *p)
+{
+    return p->id > 0 && p->id < server->game->next_player_id &&
+        p->x >= 0 && (size_t)p->x < server->config.width &&
+        p->y >= 0 && (size_t)p->y < server->config.height &&
+        p->orientation >= 1 && p->orientation <= 4 &&
+        p->level >= 1 && p->level <= TEAM_MAX_LEVEL &&
+        (size_t)p->team_id < server->config.team_count &&
+        p->elevation_age <= server->tick_count &&
+        p->action_count <= SNAP_MAX_ACTIONS;
+}
+
+static int read_fields(const server_t *server, snap_reader_t *r,
+    parked_player_t *p)
+{
+    p->id = snap_get_u32(r);
+    p->x = snap_get_u32(r);
+    p->y = snap_get_u32(r);
+    p->orientation = snap_get_u8(r);
+    p->level = snap_get_u8(r);
+    p->team_id = snap_get_u16(r);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+        p->resources[i] = (int32_t)snap_get_u32(r);
+    p->is_elevating = snap_get_u8(r);
+    p->elevation_age = snap_get_u64(r);
+    p->food_counter = snap_get_u64(r);
+    p->action_count = snap_get_u16(r);
+    return !r->failed && valid_fields(server, p) ? 0 : -1;
+}
+
+static int read_actions(snap_reader_t *r, parked_player_t *p)
+{
+    if (p->action_count == 0)
+        return 0;
+    p->actions = calloc(p->action_count, sizeof(*p->actions));
+    if (!p->actions)
+        return -1;
+    for (size_t a = 0; a < p->action_count; ++a) {
+        p->actions[a].type = snap_get_u8(r);
+        p->actions[a].delay = snap_get_u64(r);
+        p->actions[a].arg = snap_get_string(r);
+        if (r->failed || p->actions[a].type >= AI_ACTION_COUNT)
+            return -1;
+    }
+    return 0;
+}
+
+// Every player comes back parked and keeps its team seat. A record is
+// counted before it is read so a failure still frees what it holds.
+int snapshot_read_players(server_t *server, snap_reader_t *r)
+{
+    uint32_t count = snap_get_u32(r);
+    parked_player_t *p;
+
+    if (r->failed || count > (r->size - r->pos) / SNAP_PLAYER_MIN_SIZE)
+        return -1;
+    server->parked = calloc(count ? count : 1, sizeof(*server->parked));
+    if (!server->parked)
+        return -1;
+    for (uint32_t i = 0; i < count; ++i) {
+        p = &server->parked[i];
+        server->parked_count++;
+        if (read_fields(server, r, p) == -1 || read_actions(r, p) == -1)
+            return -1;
+        server->game->team_members[p->team_id]++;
+    }
+    return 0;
+}
+
+static bool valid_egg(const server_t *server, const egg_t *egg)
+{
+    return egg->id >= 0 && egg->id < server->next_egg_id &&
+        egg->x >= 0 && (size_t)egg->x < server->config.width &&
+        egg->y >= 0 && (size_t)egg->y < server->config.height;
+}
+
+static int read_egg(server_t *server, snap_reader_t *r)
+{
+    egg_t *egg = object_pool_alloc(&server->egg_pool);
+    team_eggs_t *team;
+
+    if (!egg)
+        return -1;
+    egg->id = snap_get_u32(r);
+    egg->team_id = snap_get_u16(r);
+    egg->x = snap_get_u32(r);
+    egg->y = snap_get_u32(r);
+    egg->hatched = snap_get_u8(r);
+    team = egg_manager_team(server, egg->team_id);
+    if (r->failed || !team || !valid_egg(server, egg)) {
+        object_pool_free(&server->egg_pool, egg);
+        return -1;
+    }
+    egg_list_push(egg->hatched ? &team->hatched : &team->unhatched, egg);
+    team->laid_count++;
+    team->hatched_count += egg->hatched;
+    return 0;
+}
+
+int snapshot_read_eggs(server_t *server, snap_reader_t *r)
+{
+    uint32_t count = snap_get_u32(r);
+
+    if (r->failed)
+        return -1;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (read_egg(server, r) == -1)
+            return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_restore.c
+** File description:
+** Rebuilds a game from a snapshot at startup
+*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "server/map.h"
+#include "snapshot_internal.h"
+
+static void read_all(int fd, snap_reader_t *r)
+{
+    ssize_t n;
+
+    for (r->pos = 0; r->data && r->pos < r->size; r->pos += n) {
+        n = read(fd, r->data + r->pos, r->size - r->pos);
+        if (n <= 0)
+            break;
+    }
+}
+
+static int load_file(const char *path, snap_reader_t *r)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+
+    if (fd == -1)
+        return -1;
+    if (fstat(fd, &st) == -1 || st.st_size < (off_t)sizeof(uint64_t)) {
+        close(fd);
+        return -1;
+    }
+    r->size = st.st_size;
+    r->data = malloc(r->size);
+    read_all(fd, r);
+    close(fd);
+    if (!r->data || r->pos != r->size)
+        return -1;
+    r->pos = 0;
+    return 0;
+}
+
+// The trailer is cut off, nothing can read past the checksummed bytes
+static int check_trailer(snap_reader_t *r)
+{
+    uint64_t stored;
+
+    r->size -= sizeof(stored);
+    memcpy(&stored, r->data + r->size, sizeof(stored));
+    return snap_hash(SNAP_HASH_SEED, r->data, r->size) == stored ? 0 : -1;
+}
+
+static int read_header(server_t *server, snap_reader_t *r)
+{
+    bool same = snap_get_u32(r) == SNAPSHOT_MAGIC &&
+        snap_get_u32(r) == SNAPSHOT_VERSION &&
+        snap_get_u32(r) == server->config.width &&
+        snap_get_u32(r) == server->config.height &&
+        snap_get_u32(r) == server->config.team_count;
+    char *name;
+
+    for (size_t t = 0; same && t < server->config.team_count; ++t) {
+        name = snap_get_string(r);
+        same = name && strcmp(name, server->config.team_names[t]) == 0;
+        free(name);
+    }
+    if (!same)
+        return -1;
+    server->tick_count = snap_get_u64(r);
+    server->game->next_player_id = snap_get_u32(r);
+    server->next_egg_id = snap_get_u32(r);
+    server->scheduler.next_seq = snap_get_u64(r);
+    snap_get(r, server->rng.s, sizeof(server->rng.s));
+    return r->failed || server->game->next_player_id < 1 ? -1 : 0;
+}
+
+static int read_map(map_t *map, snap_reader_t *r)
+{
+    snap_get(r, map->stacks,
+        map->tile_count * RESOURCE_COUNT * sizeof(tile_stack_t));
+    if (r->failed)
+        return -1;
+    for (int type = 0; type < RESOURCE_COUNT; ++type) {
+        map->totals[type] = 0;
+        for (size_t tile = 0; tile < map->tile_count; ++tile)
+            map->totals[type] += map_stack(map, tile, type);
+    }
+    return 0;
+}
+
+int snapshot_restore(server_t *server, const char *path)
+{
+    snap_reader_t r = {0};
+    int ret = -1;
+
+    if (load_file(path, &r) == 0 && check_trailer(&r) == 0 &&
+        read_header(server, &r) == 0 &&
+        read_map(server->game->map, &r) == 0 &&
+        snapshot_read_players(server, &r) == 0 &&
+        snapshot_read_eggs(server, &r) == 0 && r.pos == r.size)
+        ret = 0;
+    free(r.data);
+    if (ret == -1) {
+        LOG_ERROR("[SNAPSHOT] %s is not a snapshot of this game", path);
+        return -1;
+    }
+    LOG_INFO("[SNAPSHOT] Restored tick %llu from %s, %zu players parked",
+        (unsigned long long)server->tick_count, path, server->parked_count);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_resume.c
+** File description:
+** Parked players taken over by reconnecting clients
+*/
+
+#include <string.h>
+
+#include "server/broadcast.h"
+#include "server/journal.h"
+#include "server/payloads.h"
+#include "server/protocol_ai.h"
+#include "snapshot_internal.h"
+
+static void free_actions(parked_player_t *parked)
+{
+    for (size_t a = 0; a < parked->action_count; ++a)
+        free(parked->actions[a].arg);
+    free(parked->actions);
+    parked->actions = NULL;
+    parked->action_count = 0;
+}
+
+// Shifted rather than swapped, so a team's players come back in id order
+static void release_parked(server_t *server, size_t i)
+{
+    free_actions(&server->parked[i]);
+    memmove(&server->parked[i], &server->parked[i + 1],
+        (server->parked_count - i - 1) * sizeof(*server->parked));
+    server->parked_count--;
+}
+
+static player_t *unpark(server_t *server, client_t *client,
+    const parked_player_t *parked)
+{
+    player_t *player = player_create(client, parked->x, parked->y,
+        server->config.team_names[parked->team_id]);
+
+    if (!player)
+        return NULL;
+    player->id = parked->id;
+    player->team_id = parked->team_id;
+    player->orientation = parked->orientation;
+    player->level = parked->level;
+    memcpy(player->resources, parked->resources, sizeof(player->resources));
+    player->is_elevating = parked->is_elevating;
+    player->elevation_start_tick = server->tick_count - parked->elevation_age;
+    player->last_food_inhalation = parked->food_counter;
+    return player;
+}
+
+static void requeue_actions(server_t *server, client_t *client,
+    const parked_player_t *parked)
+{
+    const snapshot_action_t *action;
+
+    for (size_t a = 0; a < parked->action_count; ++a) {
+        action = &parked->actions[a];
+        if (requeue_action(server, client, action->arg, action->type,
+            server->tick_count + action->delay) == -1)
+            LOG_WARN("[SNAPSHOT] Player %d lost a pending action",
+                parked->id);
+    }
+}
+
+static size_t find_parked(const server_t *server, int team_id)
+{
+    size_t i = 0;
+
+    while (i < server->parked_count && server->parked[i].team_id != team_id)
+        ++i;
+    return i;
+}
+
+// The seat moves from the parked record to the player
+bool snapshot_resume(server_t *server, client_t *client, int team_id)
+{
+    size_t i = find_parked(server, team_id);
+    player_t *player;
+
+    if (team_id < 0 || i == server->parked_count)
+        return false;
+    player = unpark(server, client, &server->parked[i]);
+    server->game->team_members[team_id]--;
+    if (!player || add_player_to_game(server->game, player) == -1) {
+        server->game->team_members[team_id]++;
+        player_destroy(player);
+        return false;
+    }
+    client->player = player;
+    client->is_authenticated = true;
+    player_set_position(server, player, player->x, player->y);
+    broadcast_message_to_guis(server, player, gui_payload_pnw);
+    journal_player(server, JOURNAL_PNW, player);
+    requeue_actions(server, client, &server->parked[i]);
+    release_parked(server, i);
+    return true;
+}
+
+void snapshot_parked_destroy(server_t *server)
+{
+    for (size_t i = 0; i < server->parked_count; ++i)
+        free_actions(&server->parked[i]);
+    free(server->parked);
+    server->parked = NULL;
+    server->parked_count = 0;
+}
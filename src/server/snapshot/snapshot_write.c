@@ -0,0 +1,172 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/snapshot/snapshot_write.c
+** File description:
+** Serializes a game between two ticks
+*/
+
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "server/egg.h"
+#include "server/protocol_ai.h"
+#include "server/time.h"
+#include "snapshot_internal.h"
+
+static void write_header(snap_writer_t *w, const server_t *server)
+{
+    snap_put_u32(w, SNAPSHOT_MAGIC);
+    snap_put_u32(w, SNAPSHOT_VERSION);
+    snap_put_u32(w, server->config.width);
+    snap_put_u32(w, server->config.height);
+    snap_put_u32(w, server->config.team_count);
+    for (size_t t = 0; t < server->config.team_count; ++t)
+        snap_put_string(w, server->config.team_names[t]);
+    snap_put_u64(w, server->tick_count);
+    snap_put_u32(w, server->game->next_player_id);
+    snap_put_u32(w, server->next_egg_id);
+    snap_put_u64(w, server->scheduler.next_seq);
+    snap_put(w, server->rng.s, sizeof(server->rng.s));
+}
+
+static void write_map(snap_writer_t *w, const map_t *map)
+{
+    snap_put(w, map->stacks,
+        map->tile_count * RESOURCE_COUNT * sizeof(tile_stack_t));
+}
+
+static void write_fields(snap_writer_t *w, const parked_player_t *p,
+    size_t action_count)
+{
+    snap_put_u32(w, p->id);
+    snap_put_u32(w, p->x);
+    snap_put_u32(w, p->y);
+    snap_put_u8(w, p->orientation);
+    snap_put_u8(w, p->level);
+    snap_put_u16(w, p->team_id);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+        snap_put_u32(w, (uint32_t)p->resources[i]);
+    snap_put_u8(w, p->is_elevating);
+    snap_put_u64(w, p->elevation_age);
+    snap_put_u64(w, p->food_counter);
+    snap_put_u16(w, action_count);
+}
+
+static void write_action(snap_writer_t *w, uint8_t type, uint64_t delay,
+    const char *arg)
+{
+    snap_put_u8(w, type);
+    snap_put_u64(w, delay);
+    snap_put_string(w, arg);
+}
+
+static void write_live_player(snap_writer_t *w, const server_t *server,
+    const player_t *player)
+{
+    parked_player_t rec = {.id = player->id, .x = player->x,
+        .y = player->y, .orientation = player->orientation,
+        .level = player->level, .team_id = player->team_id,
+        .is_elevating = player->is_elevating,
+        .food_counter = player->last_food_inhalation};
+    const client_t *client = player->client;
+    const action_t *action = client ? client->action_queue_head : NULL;
+
+    if (player->is_elevating)
+        rec.elevation_age = server->tick_count - player->elevation_start_tick;
+    memcpy(rec.resources, player->resources, sizeof(rec.resources));
+    write_fields(w, &rec, client ? client->action_queue_count : 0);
+    for (; action; action = action->next)
+        write_action(w, ((ai_action_data_t *)action->data)->type,
+            action->exec_tick > server->tick_count ?
+            action->exec_tick - server->tick_count : 0, action->command);
+}
+
+// Live players first, then those still parked since the last restore
+static void write_players(snap_writer_t *w, const server_t *server)
+{
+    const game_state_t *game = server->game;
+    uint32_t count = server->parked_count;
+    const parked_player_t *p;
+
+    for (size_t i = 0; i < game->player_count; ++i)
+        count += game->players[i]->is_alive;
+    snap_put_u32(w, count);
+    for (size_t i = 0; i < game->player_count; ++i)
+        if (game->players[i]->is_alive)
+            write_live_player(w, server, game->players[i]);
+    for (size_t i = 0; i < server->parked_count; ++i) {
+        p = &server->parked[i];
+        write_fields(w, p, p->action_count);
+        for (size_t a = 0; a < p->action_count; ++a)
+            write_action(w, p->actions[a].type, p->actions[a].delay,
+                p->actions[a].arg);
+    }
+}
+
+// Tail first, the reader pushes each egg at the head of its list
+static void write_egg_list(snap_writer_t *w, const egg_t *egg)
+{
+    while (egg && egg->next)
+        egg = egg->next;
+    for (; egg; egg = egg->prev) {
+        snap_put_u32(w, egg->id);
+        snap_put_u16(w, egg->team_id);
+        snap_put_u32(w, egg->x);
+        snap_put_u32(w, egg->y);
+        snap_put_u8(w, egg->hatched);
+    }
+}
+
+static void write_eggs(snap_writer_t *w, const server_t *server)
+{
+    uint32_t count = 0;
+
+    for (size_t t = 0; t < server->config.team_count; ++t)
+        count += server->team_eggs[t].laid_count;
+    snap_put_u32(w, count);
+    for (size_t t = 0; t < server->config.team_count; ++t) {
+        write_egg_list(w, server->team_eggs[t].unhatched);
+        write_egg_list(w, server->team_eggs[t].hatched);
+    }
+}
+
+int snapshot_serialize(const server_t *server, FILE *file)
+{
+    snap_writer_t w = {file, SNAP_HASH_SEED, false};
+    uint64_t hash;
+
+    write_header(&w, server);
+    write_map(&w, server->game->map);
+    write_players(&w, server);
+    write_eggs(&w, server);
+    hash = w.hash;
+    snap_put_u64(&w, hash);
+    return w.failed ? -1 : 0;
+}
+
+// Readers of path only ever see a complete file, the old one or the new
+static int commit(FILE *file, bool failed, const char *tmp, const char *path)
+{
+    failed = failed || fflush(file) != 0 || fsync(fileno(file)) != 0;
+    if (fclose(file) != 0 || failed || rename(tmp, path) == -1) {
+        unlink(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+int snapshot_write(const server_t *server, const char *path)
+{
+    char tmp[PATH_MAX];
+    FILE *file;
+
+    if (snprintf(tmp, sizeof(tmp), "%s" SNAPSHOT_TMP_SUFFIX, path) >=
+        (int)sizeof(tmp))
+        return -1;
+    file = fopen(tmp, "wb");
+    if (!file)
+        return -1;
+    setvbuf(file, NULL, _IOFBF, SNAPSHOT_BUFFER_SIZE);
+    return commit(file, snapshot_serialize(server, file) == -1, tmp, path);
+}
@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/thread.c
+** File description:
+** Helper threads started with the signals left to the main thread
+*/
+
+#include <signal.h>
+
+#include "server/thread.h"
+
+int thread_spawn_unsignaled(pthread_t *thread, void *(*routine)(void *),
+    void *arg)
+{
+    sigset_t all;
+    sigset_t previous;
+    int ret;
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);
+    ret = pthread_create(thread, NULL, routine, arg);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+    return ret == 0 ? 0 : -1;
+}
@@ -0,0 +1,182 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/tick/tick_actions.c
+** File description:
+** Due actions of a tick, split into region batches
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/protocol_ai.h"
+#include "tick_internal.h"
+
+static int reserve_task(tick_pool_t *pool)
+{
+    size_t capacity = pool->task_capacity ? pool->task_capacity * 2 : 64;
+    tick_task_t *tasks;
+
+    if (pool->task_count < pool->task_capacity)
+        return 0;
+    tasks = realloc(pool->tasks, capacity * sizeof(*tasks));
+    if (!tasks)
+        return -1;
+    memset(tasks + pool->task_capacity, 0,
+        (capacity - pool->task_capacity) * sizeof(*tasks));
+    pool->tasks = tasks;
+    pool->task_capacity = capacity;
+    return 0;
+}
+
+// Same pops as run_head_action, in the same order. Callbacks never touch
+// the queues, so taking them all first changes nothing.
+static int pop_due(server_t *server, tick_pool_t *pool)
+{
+    client_t *client = scheduler_peek_due(&server->scheduler,
+        server->tick_count);
+    action_t *action;
+
+    for (; client; client = scheduler_peek_due(&server->scheduler,
+        server->tick_count)) {
+        if (reserve_task(pool) == -1)
+            return -1;
+        action = client->action_queue_head;
+        client->action_queue_head = action->next;
+        if (!client->action_queue_head)
+            client->action_queue_tail = NULL;
+        client->action_queue_count--;
+        scheduler_update(&server->scheduler, client);
+        pool->tasks[pool->task_count].client = client;
+        pool->tasks[pool->task_count].action = action;
+        pool->task_count++;
+    }
+    return 0;
+}
+
+// Index along one axis of the region holding [pos - reach, pos + reach],
+// -1 when that span wraps or crosses a border
+static int span_region(int cells, int size, int pos, int reach)
+{
+    int low = pos - reach;
+    int high = pos + reach;
+
+    if (cells == 1)
+        return 0;
+    if (low < 0 || high >= size)
+        return -1;
+    if (low * cells / size != high * cells / size)
+        return -1;
+    return low * cells / size;
+}
+
+// Actions that read and write nothing beyond a small box around the
+// player's own tile. Forward is not one of them: changing tiles inserts
+// into and deletes from the occupancy table shared by the whole map.
+static const bool local_actions[AI_ACTION_COUNT] = {
+    [AI_ACTION_RIGHT] = true,
+    [AI_ACTION_LEFT] = true,
+    [AI_ACTION_LOOK] = true,
+    [AI_ACTION_INVENTORY] = true,
+};
+
+// Half-size of that box, -1 for the actions that must run alone
+static int action_reach(const tick_task_t *task)
+{
+    const ai_action_data_t *data = task->action->data;
+
+    if (task->action->callback != ai_callback_handler || !data ||
+        !task->client->player || data->type >= AI_ACTION_COUNT ||
+        !local_actions[data->type])
+        return -1;
+    return data->type == AI_ACTION_LOOK ? task->client->player->level : 0;
+}
+
+static uint32_t classify(const tick_pool_t *pool, const map_t *map,
+    const tick_task_t *task)
+{
+    int reach = action_reach(task);
+    const player_t *player = task->client->player;
+    int col;
+    int row;
+
+    if (reach < 0)
+        return TICK_SERIAL;
+    col = span_region(pool->region_cols, map->width, player->x, reach);
+    row = span_region(pool->region_rows, map->height, player->y, reach);
+    if (col < 0 || row < 0)
+        return TICK_SERIAL;
+    return (uint32_t)(row * pool->region_cols + col);
+}
+
+static void run_task(tick_task_t *task)
+{
+    if (task->action->callback)
+        task->action->callback(task->client, task->action->data);
+}
+
+static void run_batch(tick_pool_t *pool, size_t worker)
+{
+    tick_task_t *task;
+
+    for (size_t i = pool->batch_begin; i < pool->batch_end; ++i) {
+        task = &pool->tasks[i];
+        if (task->region % pool->count != worker)
+            continue;
+        tick_capture_begin(&task->slot);
+        run_task(task);
+        tick_capture_end();
+    }
+}
+
+// Small batches are not worth waking the workers for
+static void run_local(tick_pool_t *pool, size_t begin, size_t end)
+{
+    if (end - begin < TICK_MIN_BATCH) {
+        for (size_t i = begin; i < end; ++i)
+            run_task(&pool->tasks[i]);
+        return;
+    }
+    pool->batch_begin = begin;
+    pool->batch_end = end;
+    tick_pool_run(pool, run_batch);
+    for (size_t i = begin; i < end; ++i)
+        tick_capture_flush(pool->server, &pool->tasks[i].slot);
+}
+
+// Each batch is classified right before it runs, once every earlier
+// action has moved its player
+static void run_tasks(tick_pool_t *pool, const map_t *map)
+{
+    size_t begin = 0;
+    size_t end;
+
+    while (begin < pool->task_count) {
+        end = begin;
+        while (end < pool->task_count) {
+            pool->tasks[end].region = classify(pool, map, &pool->tasks[end]);
+            if (pool->tasks[end].region == TICK_SERIAL)
+                break;
+            end++;
+        }
+        run_local(pool, begin, end);
+        if (end < pool->task_count)
+            run_task(&pool->tasks[end]);
+        begin = end + 1;
+    }
+}
+
+void tick_pool_process_actions(server_t *server)
+{
+    tick_pool_t *pool = server->tick;
+
+    if (!pool || !server->game)
+        return process_actions(server);
+    if (pop_due(server, pool) == -1)
+        LOG_ERROR("[SERVER] Cannot batch the actions of tick %lu",
+            (unsigned long)server->tick_count);
+    run_tasks(pool, server->game->map);
+    for (size_t i = 0; i < pool->task_count; ++i)
+        action_release(server, pool->tasks[i].action);
+    pool->task_count = 0;
+    process_actions(server);
+}
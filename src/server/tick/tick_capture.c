@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/tick/tick_capture.c
+** File description:
+** Per-action capture of the replies sent during a parallel batch
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/journal.h"
+#include "tick_internal.h"
+
+// Set only while a worker runs an action of a batch
+static _Thread_local tick_slot_t *current_slot = NULL;
+
+static int reserve_output(tick_slot_t *slot)
+{
+    size_t capacity = slot->capacity ? slot->capacity * 2 : 4;
+    tick_output_t *outputs;
+
+    if (slot->count < slot->capacity)
+        return 0;
+    outputs = realloc(slot->outputs, capacity * sizeof(*outputs));
+    if (!outputs)
+        return -1;
+    slot->outputs = outputs;
+    slot->capacity = capacity;
+    return 0;
+}
+
+// A reply that cannot be kept is dropped, as a failed send would be
+bool tick_capture(client_t *client, const char *text)
+{
+    tick_slot_t *slot = current_slot;
+    char *copy;
+
+    if (!slot)
+        return false;
+    copy = strdup(text);
+    if (!copy || reserve_output(slot) == -1) {
+        free(copy);
+        return true;
+    }
+    slot->outputs[slot->count] = (tick_output_t){client, copy, NULL};
+    slot->count++;
+    return true;
+}
+
+// A record that cannot be kept is published at once, out of order rather
+// than lost
+void *tick_capture_record(size_t size)
+{
+    tick_slot_t *slot = current_slot;
+    void *record;
+
+    if (!slot)
+        return NULL;
+    record = malloc(size);
+    if (!record || reserve_output(slot) == -1) {
+        free(record);
+        return NULL;
+    }
+    slot->outputs[slot->count] = (tick_output_t){NULL, NULL, record};
+    slot->count++;
+    return record;
+}
+
+void tick_capture_begin(tick_slot_t *slot)
+{
+    current_slot = slot;
+}
+
+void tick_capture_end(void)
+{
+    current_slot = NULL;
+}
+
+void tick_capture_flush(server_t *server, tick_slot_t *slot)
+{
+    tick_output_t *output;
+
+    for (size_t i = 0; i < slot->count; ++i) {
+        output = &slot->outputs[i];
+        if (output->record)
+            journal_publish(server, output->record);
+        else
+            send_response(output->client, output->text);
+        free(output->text);
+        free(output->record);
+    }
+    slot->count = 0;
+}
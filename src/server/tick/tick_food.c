@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/tick/tick_food.c
+** File description:
+** Digestion split across the tick workers
+*/
+
+#include <stdlib.h>
+
+#include "server/lifecycle.h"
+#include "tick_internal.h"
+
+static int reserve_starving(tick_pool_t *pool, size_t count)
+{
+    bool *starving;
+
+    if (count <= pool->starving_capacity)
+        return 0;
+    starving = realloc(pool->starving, count * sizeof(*starving));
+    if (!starving)
+        return -1;
+    pool->starving = starving;
+    pool->starving_capacity = count;
+    return 0;
+}
+
+// Worker w digests the w-th contiguous slice of the players array
+static void digest_slice(tick_pool_t *pool, size_t worker)
+{
+    game_state_t *game = pool->server->game;
+    size_t slice = (game->player_count + pool->count - 1) / pool->count;
+    size_t begin = worker * slice;
+    size_t end = begin + slice;
+    player_t *player;
+
+    if (end > game->player_count)
+        end = game->player_count;
+    for (size_t i = begin; i < end; ++i) {
+        player = game->players[i];
+        pool->starving[i] = player && player->is_alive &&
+            player_digest(player);
+    }
+}
+
+// Deaths touch the map and the GUIs, so they are applied afterwards in
+// players order, as game_state_update would
+void tick_pool_update_players(server_t *server)
+{
+    tick_pool_t *pool = server->tick;
+    game_state_t *game = server->game;
+
+    if (!pool || !game || game->player_count < pool->count * TICK_MIN_BATCH
+        || reserve_starving(pool, game->player_count) == -1)
+        return game_state_update(server);
+    tick_pool_run(pool, digest_slice);
+    for (size_t i = 0; i < game->player_count; ++i) {
+        if (pool->starving[i])
+            player_die(game->players[i]->client, server);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/tick/tick_internal.h
+** File description:
+** Structures shared by the tick pool and its workers
+*/
+
+#ifndef TICK_INTERNAL_H_
+    #define TICK_INTERNAL_H_
+
+    #include <pthread.h>
+
+    #include "server/tick_pool.h"
+    #include "server/time.h"
+
+    #define TICK_SERIAL UINT32_MAX
+
+typedef struct tick_pool_s tick_pool_t;
+typedef void (*tick_job_t)(tick_pool_t *pool, size_t worker);
+
+// A reply to client, or a journal record when record is set
+typedef struct tick_output_s {
+    client_t *client;
+    char *text;
+    void *record;
+} tick_output_t;
+
+// What one action sent and journaled while it ran in a batch
+typedef struct tick_slot_s {
+    tick_output_t *outputs;
+    size_t count;
+    size_t capacity;
+} tick_slot_t;
+
+// region is TICK_SERIAL for actions that must run alone
+typedef struct tick_task_s {
+    client_t *client;
+    action_t *action;
+    uint32_t region;
+    tick_slot_t slot;
+} tick_task_t;
+
+typedef struct tick_worker_s {
+    pthread_t thread;
+    tick_pool_t *pool;
+    size_t index;
+} tick_worker_t;
+
+// Workers sleep on start until generation moves, run job, and the last
+// one to finish signals done
+struct tick_pool_s {
+    server_t *server;
+    tick_worker_t *workers;
+    size_t count;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint64_t generation;
+    size_t pending;
+    bool running;
+    tick_job_t job;
+    tick_task_t *tasks;
+    size_t task_count;
+    size_t task_capacity;
+    size_t batch_begin;
+    size_t batch_end;
+    bool *starving;
+    size_t starving_capacity;
+    int region_cols;
+    int region_rows;
+};
+
+// Runs job on every worker, the calling game thread being worker 0
+void tick_pool_run(tick_pool_t *pool, tick_job_t job);
+
+void tick_capture_begin(tick_slot_t *slot);
+void tick_capture_end(void);
+
+// Sends and journals what the slot captured, in order, and empties it
+void tick_capture_flush(server_t *server, tick_slot_t *slot);
+
+#endif /* !TICK_INTERNAL_H_ */
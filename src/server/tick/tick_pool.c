@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** src/server/tick/tick_pool.c
+** File description:
+** Tick worker pool creation, teardown and job hand-off
+*/
+
+#include <stdlib.h>
+
+#include "server/thread.h"
+#include "tick_internal.h"
+
+static void run_job(tick_worker_t *worker, tick_job_t job)
+{
+    tick_pool_t *pool = worker->pool;
+
+    job(pool, worker->index);
+    pthread_mutex_lock(&pool->lock);
+    pool->pending--;
+    if (pool->pending == 0)
+        pthread_cond_signal(&pool->done);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void *tick_worker_main(void *arg)
+{
+    tick_worker_t *worker = arg;
+    tick_pool_t *pool = worker->pool;
+    uint64_t seen = 0;
+    tick_job_t job;
+
+    while (true) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->running && pool->generation == seen)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if (!pool->running) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        job = pool->job;
+        pthread_mutex_unlock(&pool->lock);
+        run_job(worker, job);
+    }
+}
+
+void tick_pool_run(tick_pool_t *pool, tick_job_t job)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->pending = pool->count - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    job(pool, 0);
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static int spawn_worker(tick_pool_t *pool, tick_worker_t *worker)
+{
+    worker->pool = pool;
+    worker->index = pool->count;
+    return thread_spawn_unsignaled(&worker->thread, tick_worker_main,
+        worker);
+}
+
+// Regions are at least TICK_REGION_MIN tiles wide, a smaller map is one
+static int region_count(int size)
+{
+    return size / TICK_REGION_MIN > 0 ? size / TICK_REGION_MIN : 1;
+}
+
+static tick_pool_t *create_pool(server_t *server, size_t count)
+{
+    tick_pool_t *pool = calloc(1, sizeof(*pool));
+    map_t *map = server->game->map;
+
+    if (!pool)
+        return NULL;
+    pool->workers = calloc(count, sizeof(tick_worker_t));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+    pool->server = server;
+    pool->running = true;
+    pool->count = 1;
+    pool->region_cols = region_count(map->width);
+    pool->region_rows = region_count(map->height);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    return pool;
+}
+
+int tick_pool_create(server_t *server)
+{
+    size_t count = server->config.tick_threads;
+
+    if (count < 2)
+        return 0;
+    server->tick = create_pool(server, count);
+    if (!server->tick)
+        return -1;
+    while (server->tick->count < count) {
+        if (spawn_worker(server->tick,
+            &server->tick->workers[server->tick->count]) == -1) {
+            tick_pool_destroy(server);
+            return -1;
+        }
+        server->tick->count++;
+    }
+    LOG_INFO("[SERVER] Tick threads: %zu (%d regions)", count,
+        server->tick->region_cols * server->tick->region_rows);
+    return 0;
+}
+
+void tick_pool_destroy(server_t *server)
+{
+    tick_pool_t *pool = server->tick;
+
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->running = false;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 1; i < pool->count; ++i)
+        pthread_join(pool->workers[i].thread, NULL);
+    for (size_t i = 0; i < pool->task_capacity; ++i)
+        free(pool->tasks[i].slot.outputs);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->tasks);
+    free(pool->starving);
+    free(pool->workers);
+    free(pool);
+    server->tick = NULL;
+}
@@ -21,22 +21,23 @@ double get_time_unit(server_t *server)
 bool set_time_unit(server_t *server, double time_unit)
 {
     if (!server || time_unit <= 0.0) {
-        fprintf(stderr, "Invalid time unit value: %f\n", time_unit);
+        LOG_WARN("Invalid time unit value: %f", time_unit);
         return false;
     }
     server->config.freq = (size_t)(1.0 / time_unit);
     if (server->config.freq == 0) {
-        fprintf(stderr, "Frequency cannot be zero.\n");
+        LOG_WARN("Frequency cannot be zero.");
         return false;
     }
     return true;
 }
 
-void queue_action(client_t *client, action_t *action)
+void queue_action(server_t *server, client_t *client, action_t *action)
 {
-    if (!client || !action)
+    if (!server || !client || !action)
         return;
     action->next = NULL;
+    action->seq = server->scheduler.next_seq++;
     if (!client->action_queue_tail) {
         client->action_queue_head = action;
         client->action_queue_tail = action;
@@ -45,44 +46,47 @@ void queue_action(client_t *client, action_t *action)
         client->action_queue_tail = action;
     }
     client->action_queue_count++;
+    if (client->action_queue_head == action &&
+        scheduler_update(&server->scheduler, client) == -1)
+        LOG_ERROR("[SERVER] Cannot schedule action for client %d",
+            client->fd);
 }
 
-static void execute_action_callback(client_t *client,
-    action_t *action, double now)
-{
-    (void)now;
-    if (action->callback) {
-        action->callback(client, action->data);
-    }
-}
-
-static int process_ready_action(client_t *client, double now)
+// The client is rescheduled on its next action before the callback runs
+static void run_head_action(server_t *server, client_t *client)
 {
     action_t *action = client->action_queue_head;
-    action_t *to_free;
 
-    if (!action)
-        return 0;
-    if (action->exec_time > now)
-        return 0;
     client->action_queue_head = action->next;
     if (!client->action_queue_head)
         client->action_queue_tail = NULL;
     client->action_queue_count--;
-    execute_action_callback(client, action, now);
-    to_free = action;
-    free(to_free->command);
-    free(to_free);
-    return 1;
+    scheduler_update(&server->scheduler, client);
+    if (action->callback)
+        action->callback(client, action->data);
+    action_release(server, action);
 }
 
+// Runs once per tick, before the world update; heads are popped in
+// (exec_tick, seq) order so the outcome never depends on wall-clock timing
 void process_actions(server_t *server)
 {
-    double now = get_current_time();
     client_t *client;
 
-    for (size_t i = 0; server && i < server->client_count; ++i) {
-        client = &server->clients[i];
-        while (process_ready_action(client, now));
+    if (!server)
+        return;
+    client = scheduler_peek_due(&server->scheduler, server->tick_count);
+    while (client) {
+        run_head_action(server, client);
+        client = scheduler_peek_due(&server->scheduler, server->tick_count);
     }
 }
+
+// The data always comes from action_data_pool, whether or not it ran
+void action_release(server_t *server, action_t *action)
+{
+    if (action->command != action->inline_command)
+        free(action->command);
+    object_pool_free(&server->action_data_pool, action->data);
+    object_pool_free(&server->action_pool, action);
+}
@@ -7,75 +7,116 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 #include "server/vision.h"
-#include "server/dynamic_array.h"
 #include "server/game.h"
 #include "server/server.h"
+#include "server/map.h"
 
-static char *print_tile(tile_t *tile)
+// Cell k of a level L cone, for k < (L + 1)^2, indexed by orientation - 1
+static vision_offset_t vision_offsets[4][VISION_MAX_CELLS];
+// " name" for every resource, so each item is a single memcpy
+static char item_names[RESSOURCE_COUNT][VISION_ITEM_SIZE];
+static size_t item_lengths[RESSOURCE_COUNT];
+
+// Row dist, columns from the player's left to right, as seen facing north
+// then rotated for east, south and west
+static void build_tables(void)
 {
-    char *str = da_create();
+    size_t k = 0;
 
-    if (!tile)
-        return da_create();
-    if (tile->player_count) {
-        str = da_push(str, "player", 6);
-    }
-    for (int i = 0; i < 7; ++i) {
-        for (int j = 0; j < tile->resources[i]; ++j) {
-            str = da_push(str, " ", 1);
-            str = da_push(str, ressource_string_table[i],
-                strlen(ressource_string_table[i]));
+    for (int dist = 0; dist <= VISION_MAX_LEVEL; ++dist) {
+        for (int off = -dist; off <= dist; ++off) {
+            vision_offsets[0][k] = (vision_offset_t){off, -dist};
+            vision_offsets[1][k] = (vision_offset_t){dist, off};
+            vision_offsets[2][k] = (vision_offset_t){-off, dist};
+            vision_offsets[3][k] = (vision_offset_t){-dist, -off};
+            ++k;
         }
     }
-    return str;
+    for (int i = 0; i < RESSOURCE_COUNT; ++i)
+        item_lengths[i] = snprintf(item_names[i], VISION_ITEM_SIZE, " %s",
+            ressource_string_table[i]);
+}
+
+// Hosted games start on their own threads, the tables are shared
+void vision_init(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, build_tables);
+}
+
+static void read_cell(const map_t *map, const player_t *player,
+    const vision_offset_t *offset, vision_cell_t *cell)
+{
+    tile_id_t tile = map_wrap_tile(map, player->x + offset->dx,
+        player->y + offset->dy);
+
+    cell->occupied = map_player_count(map, tile) > 0;
+    for (int i = 0; i < RESSOURCE_COUNT; ++i)
+        cell->stacks[i] = map_stack(map, tile, i);
+}
+
+static size_t cell_length(const vision_cell_t *cell)
+{
+    size_t len = cell->occupied ? 6 : 0;
+
+    for (int i = 0; i < RESSOURCE_COUNT; ++i)
+        len += (size_t)cell->stacks[i] * item_lengths[i];
+    return len;
 }
 
-static void vision_loop_iteration(struct vision_loop_s *s)
+static char *write_cell(char *out, const vision_cell_t *cell)
 {
-    if (s->orientation == 1) {
-        *s->x = (*s->x + s->offset) % s->map->width;
-        *s->y = (*s->y - s->dist + s->map->height) % s->map->height;
-    } else if (s->orientation == 2) {
-        *s->x = (*s->x + s->dist + s->map->width) % s->map->width;
-        *s->y = (*s->y + s->offset) % s->map->height;
-        return;
+    if (cell->occupied) {
+        memcpy(out, "player", 6);
+        out += 6;
     }
-    if (s->orientation == 3) {
-        *s->x = (*s->x - s->offset + s->map->width) % s->map->width;
-        *s->y = (*s->y + s->dist + s->map->height) % s->map->height;
-        return;
+    for (int i = 0; i < RESSOURCE_COUNT; ++i) {
+        for (int j = 0; j < cell->stacks[i]; ++j) {
+            memcpy(out, item_names[i], item_lengths[i]);
+            out += item_lengths[i];
+        }
     }
-    *s->x = (*s->x - s->dist + s->map->width) % s->map->width;
-    *s->y = (*s->y - s->offset + s->map->height) % s->map->height;
+    return out;
 }
 
-static void add_tile_to_response(char **res, char *tile, int *first)
+static void write_response(char *out, const vision_cell_t *tiles,
+    size_t cells)
 {
-    if (!*first)
-        *res = da_push(*res, ", ", 1);
-    *res = da_push(*res, tile, DA_LEN(tile));
-    da_destroy(tile);
-    *first = 0;
+    *out = '[';
+    out++;
+    for (size_t k = 0; k < cells; ++k) {
+        if (k > 0) {
+            *out = ',';
+            out++;
+        }
+        out = write_cell(out, &tiles[k]);
+    }
+    memcpy(out, "]\n", 3);
 }
 
+// The length is summed from the tiles first, so the line is written in a
+// single pass into one exact-size allocation
 char *vision_look(client_t *client, map_t *map)
 {
-    char *res = da_push(da_create(), "[", 1);
-    int x = client->player->x;
-    int y = client->player->y;
-    char *tile = NULL;
-    int first = 1;
+    const player_t *player = client->player;
+    int level = player->level < VISION_MAX_LEVEL ?
+        player->level : VISION_MAX_LEVEL;
+    size_t cells = (size_t)(level + 1) * (level + 1);
+    const vision_offset_t *table =
+        vision_offsets[(player->orientation - 1) & 3];
+    vision_cell_t tiles[VISION_MAX_CELLS];
+    size_t len = cells + 3;
+    char *res;
 
-    for (int dist = 0; dist <= client->player->level; ++dist) {
-        for (int offset = -dist; offset <= dist; ++offset) {
-            vision_loop_iteration(&(struct vision_loop_s) { &x, &y,
-                dist, offset, client->player->orientation, client->player, map
-            });
-            tile = print_tile(map_get_tile(map, x, y));
-            add_tile_to_response(&res, tile, &first);
-            first = 0;
-        }
+    for (size_t k = 0; k < cells; ++k) {
+        read_cell(map, player, &table[k], &tiles[k]);
+        len += cell_length(&tiles[k]);
     }
-    return da_push(res, "]\n", 3);
+    res = malloc(len);
+    if (res)
+        write_response(res, tiles, cells);
+    return res;
 }
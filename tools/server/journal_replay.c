@@ -0,0 +1,545 @@
+/*
+** EPITECH PROJECT, 2025
+** tools/server/journal_replay.c
+** File description:
+** Rebuilds game states from a --journal file and checks its keyframes
+*/
+
+#include "journal_replay.h"
+
+static unsigned char *load_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long length;
+
+    if (!file)
+        return NULL;
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 &&
+        fseek(file, 0, SEEK_SET) == 0) {
+        data = malloc(length);
+        *size = length;
+    }
+    if (data && fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+// False past the end of the file or on a record that overruns it
+static bool read_record(const snap_reader_t *file, size_t offset,
+    record_t *rec)
+{
+    snap_reader_t r = {file->data, file->size, offset, false};
+    uint32_t size = snap_get_u32(&r);
+
+    rec->event = snap_get_u8(&r);
+    rec->tick = snap_get_u64(&r);
+    if (r.failed || size < RECORD_HEAD - 4 ||
+        size - (RECORD_HEAD - 4) > file->size - r.pos)
+        return false;
+    rec->offset = offset;
+    rec->next = offset + 4 + size;
+    rec->payload = (snap_reader_t){file->data + r.pos,
+        size - (RECORD_HEAD - 4), 0, false};
+    return true;
+}
+
+static void skip_strings(snap_reader_t *r, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        free(snap_get_string(r));
+}
+
+// Header and clock, of which only the tick and the map size matter here
+static int read_image_header(snap_reader_t *r, replay_state_t *state)
+{
+    unsigned char rng[32];
+
+    if (snap_get_u32(r) != SNAPSHOT_MAGIC ||
+        snap_get_u32(r) != SNAPSHOT_VERSION)
+        return -1;
+    state->width = snap_get_u32(r);
+    state->height = snap_get_u32(r);
+    skip_strings(r, snap_get_u32(r));
+    state->tick = snap_get_u64(r);
+    snap_get_u32(r);
+    snap_get_u32(r);
+    snap_get_u64(r);
+    snap_get(r, rng, sizeof(rng));
+    return r->failed ? -1 : 0;
+}
+
+static void read_image_player(snap_reader_t *r, replay_player_t *p)
+{
+    uint16_t actions;
+
+    p->id = snap_get_u32(r);
+    p->x = snap_get_u32(r);
+    p->y = snap_get_u32(r);
+    p->orientation = snap_get_u8(r);
+    p->level = snap_get_u8(r);
+    p->team = snap_get_u16(r);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+        p->resources[i] = snap_get_u32(r);
+    snap_get_u8(r);
+    snap_get_u64(r);
+    p->food_counter = snap_get_u64(r);
+    actions = snap_get_u16(r);
+    for (uint16_t a = 0; a < actions && !r->failed; ++a) {
+        snap_get_u8(r);
+        snap_get_u64(r);
+        skip_strings(r, 1);
+    }
+}
+
+static int read_image_players(snap_reader_t *r, replay_state_t *state)
+{
+    uint32_t count = snap_get_u32(r);
+
+    if (r->failed || count > r->size / SNAP_PLAYER_MIN_SIZE)
+        return -1;
+    state->players = calloc(count + 1, sizeof(*state->players));
+    if (!state->players)
+        return -1;
+    for (; state->player_count < count && !r->failed; ++state->player_count)
+        read_image_player(r, &state->players[state->player_count]);
+    return r->failed ? -1 : 0;
+}
+
+static int read_image_eggs(snap_reader_t *r, replay_state_t *state)
+{
+    uint32_t count = snap_get_u32(r);
+    replay_egg_t *egg;
+
+    if (r->failed || count > r->size)
+        return -1;
+    state->eggs = calloc(count + 1, sizeof(*state->eggs));
+    if (!state->eggs)
+        return -1;
+    for (; state->egg_count < count && !r->failed; ++state->egg_count) {
+        egg = &state->eggs[state->egg_count];
+        egg->id = snap_get_u32(r);
+        egg->team = snap_get_u16(r);
+        egg->x = snap_get_u32(r);
+        egg->y = snap_get_u32(r);
+        snap_get_u8(r);
+    }
+    return r->failed ? -1 : 0;
+}
+
+static int read_image_map(snap_reader_t *r, replay_state_t *state)
+{
+    size_t size = (size_t)state->width * state->height * RESOURCE_COUNT *
+        sizeof(tile_stack_t);
+
+    if (state->width == 0 || state->height == 0 ||
+        size > r->size - r->pos)
+        return -1;
+    state->stacks = malloc(size);
+    if (!state->stacks)
+        return -1;
+    snap_get(r, state->stacks, size);
+    return r->failed ? -1 : 0;
+}
+
+// The image after the keyframe's back link, checked against its trailer
+static int load_keyframe(const record_t *rec, replay_state_t *state)
+{
+    snap_reader_t r = rec->payload;
+    uint64_t hash;
+
+    memset(state, 0, sizeof(*state));
+    snap_get_u64(&r);
+    if (r.failed || r.size - r.pos < 8)
+        return -1;
+    r.data += r.pos;
+    r.size -= r.pos + 8;
+    r.pos = 0;
+    memcpy(&hash, r.data + r.size, sizeof(hash));
+    if (snap_hash(SNAP_HASH_SEED, r.data, r.size) != hash ||
+        read_image_header(&r, state) == -1 ||
+        read_image_map(&r, state) == -1 ||
+        read_image_players(&r, state) == -1 ||
+        read_image_eggs(&r, state) == -1)
+        return -1;
+    return r.pos == r.size ? 0 : -1;
+}
+
+static void free_state(replay_state_t *state)
+{
+    free(state->stacks);
+    free(state->players);
+    free(state->eggs);
+}
+
+// Digestion is not journaled: every player on the map digests once a tick
+static void advance(replay_state_t *state, uint64_t tick)
+{
+    replay_player_t *p;
+
+    for (; state->tick < tick; state->tick++) {
+        for (size_t i = 0; i < state->player_count; ++i) {
+            p = &state->players[i];
+            p->food_counter++;
+            if (p->food_counter < FOOD_INHALATION_TIME)
+                continue;
+            p->resources[RESOURCE_FOOD]--;
+            p->food_counter = 0;
+        }
+    }
+}
+
+static replay_player_t *find_player(replay_state_t *state, uint32_t id)
+{
+    for (size_t i = 0; i < state->player_count; ++i) {
+        if (state->players[i].id == id)
+            return &state->players[i];
+    }
+    return NULL;
+}
+
+static replay_player_t *add_player(replay_state_t *state, uint32_t id)
+{
+    replay_player_t *players = realloc(state->players,
+        (state->player_count + 1) * sizeof(*players));
+
+    if (!players)
+        return NULL;
+    state->players = players;
+    memset(&players[state->player_count], 0, sizeof(*players));
+    players[state->player_count].id = id;
+    return &players[state->player_count++];
+}
+
+// Actions run before digestion, so the records of a known player show it
+// as it was before the tick's meal. A player is spawned by a connection
+// handled after the tick, its PPO then PNW come once the meal is over.
+static int apply_player(replay_state_t *state, record_t *rec)
+{
+    snap_reader_t *r = &rec->payload;
+    uint32_t id = snap_get_u32(r);
+    replay_player_t *p = find_player(state, id);
+
+    advance(state, p && rec->event != JOURNAL_PNW ? rec->tick - 1 :
+        rec->tick);
+    if (!p)
+        p = add_player(state, id);
+    if (!p)
+        return -1;
+    p->x = snap_get_u16(r);
+    p->y = snap_get_u16(r);
+    p->orientation = snap_get_u8(r);
+    p->level = snap_get_u8(r);
+    p->team = snap_get_u16(r);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+        p->resources[i] = snap_get_u32(r);
+    return r->failed ? -1 : 0;
+}
+
+static void remove_player(replay_state_t *state, uint32_t id)
+{
+    replay_player_t *p = find_player(state, id);
+
+    if (!p)
+        return;
+    state->player_count--;
+    *p = state->players[state->player_count];
+}
+
+static void apply_tile(replay_state_t *state, snap_reader_t *r)
+{
+    size_t tiles = (size_t)state->width * state->height;
+    uint16_t x = snap_get_u16(r);
+    uint16_t y = snap_get_u16(r);
+    size_t tile = (size_t)y * state->width + x;
+
+    for (int type = 0; type < RESOURCE_COUNT; ++type) {
+        if (tile < tiles)
+            state->stacks[type * tiles + tile] = snap_get_u16(r);
+    }
+}
+
+// A laid egg belongs to its parent's team
+static int add_egg(replay_state_t *state, snap_reader_t *r)
+{
+    replay_egg_t *eggs = realloc(state->eggs,
+        (state->egg_count + 1) * sizeof(*eggs));
+    replay_egg_t *egg;
+    replay_player_t *parent;
+
+    if (!eggs)
+        return -1;
+    state->eggs = eggs;
+    egg = &eggs[state->egg_count];
+    egg->id = snap_get_u32(r);
+    parent = find_player(state, snap_get_u32(r));
+    egg->team = parent ? parent->team : 0;
+    egg->x = snap_get_u16(r);
+    egg->y = snap_get_u16(r);
+    state->egg_count++;
+    return parent && !r->failed ? 0 : -1;
+}
+
+static void remove_egg(replay_state_t *state, uint32_t id)
+{
+    for (size_t i = 0; i < state->egg_count; ++i) {
+        if (state->eggs[i].id != id)
+            continue;
+        state->egg_count--;
+        state->eggs[i] = state->eggs[state->egg_count];
+        return;
+    }
+}
+
+// PIC, PIE and SEG change nothing the journal tracks
+static int apply(replay_state_t *state, record_t *rec)
+{
+    if (rec->event >= JOURNAL_PNW && rec->event <= JOURNAL_PLV)
+        return apply_player(state, rec);
+    if (rec->event == JOURNAL_PDI || rec->event == JOURNAL_EBO ||
+        rec->event == JOURNAL_EDI)
+        advance(state, rec->tick);
+    if (rec->event == JOURNAL_PDI)
+        remove_player(state, snap_get_u32(&rec->payload));
+    if (rec->event == JOURNAL_BCT)
+        apply_tile(state, &rec->payload);
+    if (rec->event == JOURNAL_ENW)
+        return add_egg(state, &rec->payload);
+    if (rec->event == JOURNAL_EBO || rec->event == JOURNAL_EDI)
+        remove_egg(state, snap_get_u32(&rec->payload));
+    return rec->payload.failed ? -1 : 0;
+}
+
+// Applies the records after from up to the next keyframe, or up to the
+// end of tick when it comes first; returns how many were applied
+static long replay(const snap_reader_t *file, const record_t *from,
+    replay_state_t *state, uint64_t tick)
+{
+    record_t rec;
+    long count = 0;
+
+    for (size_t at = from->next; read_record(file, at, &rec); at = rec.next) {
+        if (rec.event == JOURNAL_KEYFRAME || rec.event == JOURNAL_END ||
+            rec.tick > tick)
+            break;
+        if (apply(state, &rec) == -1) {
+            fprintf(stderr, "Bad %u record at offset %zu\n",
+                rec.event, rec.offset);
+            return -1;
+        }
+        count++;
+    }
+    advance(state, tick);
+    return count;
+}
+
+// Keyframes newest first: from the END record, the file's last 21 bytes,
+// along the back links. A journal without END is walked from the start.
+static size_t list_keyframes(const snap_reader_t *file, size_t *offsets)
+{
+    record_t rec;
+    size_t count = 0;
+    uint64_t link = 0;
+
+    if (file->size >= FILE_HEAD + END_RECORD_SIZE &&
+        read_record(file, file->size - END_RECORD_SIZE, &rec) &&
+        rec.event == JOURNAL_END)
+        link = snap_get_u64(&rec.payload);
+    for (size_t at = FILE_HEAD; link == 0 && read_record(file, at, &rec);
+        at = rec.next) {
+        if (rec.event == JOURNAL_KEYFRAME)
+            link = rec.offset;
+    }
+    while (link != 0 && count < MAX_KEYFRAMES &&
+        read_record(file, link, &rec) && rec.event == JOURNAL_KEYFRAME) {
+        offsets[count++] = link;
+        link = snap_get_u64(&rec.payload);
+    }
+    return count;
+}
+
+static int by_player_id(const void *a, const void *b)
+{
+    uint32_t x = ((const replay_player_t *)a)->id;
+    uint32_t y = ((const replay_player_t *)b)->id;
+
+    return (x > y) - (x < y);
+}
+
+static int by_egg_id(const void *a, const void *b)
+{
+    uint32_t x = ((const replay_egg_t *)a)->id;
+    uint32_t y = ((const replay_egg_t *)b)->id;
+
+    return (x > y) - (x < y);
+}
+
+static size_t diff_players(replay_state_t *got, replay_state_t *want)
+{
+    size_t count = got->player_count < want->player_count ?
+        got->player_count : want->player_count;
+    size_t wrong = got->player_count != want->player_count;
+
+    qsort(got->players, got->player_count, sizeof(*got->players),
+        by_player_id);
+    qsort(want->players, want->player_count, sizeof(*want->players),
+        by_player_id);
+    for (size_t i = 0; i < count; ++i) {
+        if (memcmp(&got->players[i], &want->players[i],
+            sizeof(replay_player_t)) == 0)
+            continue;
+        if (wrong++ == 0)
+            printf("  player %u differs\n", want->players[i].id);
+    }
+    if (got->player_count != want->player_count)
+        printf("  %zu players rebuilt, %zu in the keyframe\n",
+            got->player_count, want->player_count);
+    return wrong;
+}
+
+// Eggs hatch nowhere in a journal, their flag is left out
+static size_t diff_eggs(replay_state_t *got, replay_state_t *want)
+{
+    size_t wrong = 0;
+
+    if (got->egg_count != want->egg_count) {
+        printf("  %zu eggs rebuilt, %zu in the keyframe\n",
+            got->egg_count, want->egg_count);
+        return 1;
+    }
+    qsort(got->eggs, got->egg_count, sizeof(*got->eggs), by_egg_id);
+    qsort(want->eggs, want->egg_count, sizeof(*want->eggs), by_egg_id);
+    for (size_t i = 0; i < got->egg_count; ++i)
+        wrong += memcmp(&got->eggs[i], &want->eggs[i],
+            sizeof(replay_egg_t)) != 0;
+    if (wrong)
+        printf("  %zu eggs differ\n", wrong);
+    return wrong;
+}
+
+static size_t diff_states(replay_state_t *got, replay_state_t *want)
+{
+    size_t tiles = (size_t)want->width * want->height;
+    size_t wrong = 0;
+
+    if (got->tick != want->tick || got->width != want->width ||
+        got->height != want->height) {
+        printf("  tick or map size differs\n");
+        return 1;
+    }
+    for (size_t i = 0; i < tiles * RESOURCE_COUNT; ++i)
+        wrong += got->stacks[i] != want->stacks[i];
+    if (wrong)
+        printf("  %zu tile stacks differ\n", wrong);
+    return wrong + diff_players(got, want) + diff_eggs(got, want);
+}
+
+// Rebuilds the newer keyframe of a pair from the older one
+static int check_pair(const snap_reader_t *file, size_t older, size_t newer)
+{
+    record_t from;
+    record_t to;
+    replay_state_t got;
+    replay_state_t want;
+    long records = -1;
+    size_t wrong = 1;
+
+    read_record(file, older, &from);
+    read_record(file, newer, &to);
+    if (load_keyframe(&from, &got) == 0 && load_keyframe(&to, &want) == 0) {
+        records = replay(file, &from, &got, want.tick);
+        wrong = records < 0 ? 1 : diff_states(&got, &want);
+    }
+    printf("tick %llu -> %llu: %ld records, %s\n",
+        (unsigned long long)from.tick, (unsigned long long)to.tick,
+        records, wrong ? "MISMATCH" : "rebuilt");
+    free_state(&got);
+    free_state(&want);
+    return wrong ? -1 : 0;
+}
+
+static int check_all(const snap_reader_t *file, const size_t *offsets,
+    size_t count)
+{
+    int status = 0;
+
+    if (count < 2) {
+        fprintf(stderr, "Need two keyframes, found %zu\n", count);
+        return -1;
+    }
+    for (size_t i = count - 1; i > 0; --i)
+        if (check_pair(file, offsets[i], offsets[i - 1]) == -1)
+            status = -1;
+    return status;
+}
+
+static void print_state(const replay_state_t *state)
+{
+    const replay_player_t *p;
+
+    printf("tick %llu, %zu players, %zu eggs\n",
+        (unsigned long long)state->tick, state->player_count,
+        state->egg_count);
+    for (size_t i = 0; i < state->player_count; ++i) {
+        p = &state->players[i];
+        printf("player %u team %u at %u %u facing %u level %u food %u\n",
+            p->id, p->team, p->x, p->y, p->orientation, p->level,
+            p->resources[RESOURCE_FOOD]);
+    }
+    for (size_t i = 0; i < state->egg_count; ++i)
+        printf("egg %u team %u at %u %u\n", state->eggs[i].id,
+            state->eggs[i].team, state->eggs[i].x, state->eggs[i].y);
+}
+
+// Seeks to the last keyframe at or before tick and replays up to it
+static int show_tick(const snap_reader_t *file, const size_t *offsets,
+    size_t count, uint64_t tick)
+{
+    record_t from;
+    replay_state_t state;
+    size_t i = 0;
+    int status = -1;
+
+    while (i < count && read_record(file, offsets[i], &from) &&
+        from.tick > tick)
+        i++;
+    if (i == count || load_keyframe(&from, &state) == -1) {
+        fprintf(stderr, "No keyframe at or before tick %llu\n",
+            (unsigned long long)tick);
+        return -1;
+    }
+    if (replay(file, &from, &state, tick) >= 0) {
+        print_state(&state);
+        status = 0;
+    }
+    free_state(&state);
+    return status;
+}
+
+// journal_replay FILE checks that each keyframe is rebuilt by replaying
+// the one before it; journal_replay FILE TICK prints the state of a tick
+int main(int argc, char **argv)
+{
+    snap_reader_t file = {NULL, 0, 0, false};
+    size_t *offsets = malloc(MAX_KEYFRAMES * sizeof(*offsets));
+    size_t count;
+    int status = -1;
+
+    if (argc == 2 || argc == 3)
+        file.data = load_file(argv[1], &file.size);
+    if (!file.data || !offsets || file.size < FILE_HEAD ||
+        ((uint32_t *)file.data)[0] != JOURNAL_MAGIC ||
+        ((uint32_t *)file.data)[1] != JOURNAL_VERSION) {
+        fprintf(stderr, "Usage: %s journal [tick]\n", argv[0]);
+    } else {
+        count = list_keyframes(&file, offsets);
+        status = argc == 3 ? show_tick(&file, offsets, count,
+            strtoull(argv[2], NULL, 10)) : check_all(&file, offsets, count);
+    }
+    free(file.data);
+    free(offsets);
+    return status == 0 ? 0 : 84;
+}
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** tools/server/journal_replay.h
+** File description:
+** Game state rebuilt from a --journal file
+*/
+
+#ifndef JOURNAL_REPLAY_H_
+    #define JOURNAL_REPLAY_H_
+
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #include "server/journal.h"
+    #include "server/journal/journal_internal.h"
+    #include "server/snapshot/snapshot_internal.h"
+
+    #define FILE_HEAD 8
+    #define RECORD_HEAD (4 + JOURNAL_HEADER_SIZE)
+    #define END_RECORD_SIZE (RECORD_HEAD + 8)
+    #define MAX_KEYFRAMES 65536
+
+typedef struct record_s {
+    size_t offset;
+    size_t next;
+    uint8_t event;
+    uint64_t tick;
+    snap_reader_t payload;
+} record_t;
+
+typedef struct replay_player_s {
+    uint32_t id;
+    uint32_t x;
+    uint32_t y;
+    uint8_t orientation;
+    uint8_t level;
+    uint16_t team;
+    uint32_t resources[RESOURCE_COUNT];
+    uint64_t food_counter;
+} replay_player_t;
+
+typedef struct replay_egg_s {
+    uint32_t id;
+    uint16_t team;
+    uint32_t x;
+    uint32_t y;
+} replay_egg_t;
+
+// What the journal can tell about a game: the map, the players on it and
+// the eggs laid, as of the end of tick
+typedef struct replay_state_s {
+    uint64_t tick;
+    uint32_t width;
+    uint32_t height;
+    tile_stack_t *stacks;
+    replay_player_t *players;
+    size_t player_count;
+    replay_egg_t *eggs;
+    size_t egg_count;
+} replay_state_t;
+
+#endif /* !JOURNAL_REPLAY_H_ */